@@ -52,6 +52,16 @@ struct binary_digits
     static_assert(!std::is_same<UIntType, char>::value, "");
 };
 
+// Binary digits of unsigned 128-bit integers, which are not integral types
+// in strict standard modes
+#if defined(__SIZEOF_INT128__)
+template <>
+struct binary_digits<__uint128_t>
+: std::integral_constant<std::size_t, 128>
+{
+};
+#endif
+
 // Binary digits value
 template <class T>
 constexpr std::size_t binary_digits_v = binary_digits<T>::value;
@@ -302,6 +312,14 @@ constexpr T _pext(T src, T msk) noexcept;
 template <class T, class... X>
 constexpr T _pext(T src, T msk, X...) noexcept;
 
+// Population count, leading and trailing zeros count of unsigned 128-bit
+// integers, on their two 64-bit halves
+#if defined(__SIZEOF_INT128__)
+constexpr __uint128_t _popcnt(__uint128_t src) noexcept;
+constexpr __uint128_t _lzcnt(__uint128_t src) noexcept;
+constexpr __uint128_t _tzcnt(__uint128_t src) noexcept;
+#endif
+
 // Byte swap
 template <class T, class T128 = decltype(__uint128_t(__builtin_bswap64(T())))>
 constexpr T _byteswap(T src) noexcept;
@@ -620,6 +638,39 @@ constexpr T _pext(T src, T msk, X...) noexcept
 
 
 
+// ---------- IMPLEMENTATION DETAILS: INSTRUCTIONS: 128-BIT COUNTS ---------- //
+#if defined(__SIZEOF_INT128__)
+// Counts the number of bits set to 1 of both halves
+constexpr __uint128_t _popcnt(__uint128_t src) noexcept
+{
+    return __builtin_popcountll(static_cast<unsigned long long int>(src))
+         + __builtin_popcountll(static_cast<unsigned long long int>(src >> 64));
+}
+
+// Counts the number of leading zeros from the high half
+constexpr __uint128_t _lzcnt(__uint128_t src) noexcept
+{
+    const unsigned long long int high = src >> 64;
+    const unsigned long long int low = src;
+    return high ? __builtin_clzll(high)
+         : low ? 64 + __builtin_clzll(low)
+         : 128;
+}
+
+// Counts the number of trailing zeros from the low half
+constexpr __uint128_t _tzcnt(__uint128_t src) noexcept
+{
+    const unsigned long long int high = src >> 64;
+    const unsigned long long int low = src;
+    return low ? __builtin_ctzll(low)
+         : high ? 64 + __builtin_ctzll(high)
+         : 128;
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
 // ------------ IMPLEMENTATION DETAILS: INSTRUCTIONS: BYTE SWAP ------------- //
 // Reverses the order of the underlying bytes with compiler intrinsics
 template <class T, class T128>
@@ -690,7 +741,7 @@ constexpr T _bitswap(T src) noexcept
     if (is_size1 && is_byte && is_octet) {
         dst = ((src * first) & second) * third >> fourth;
     } else if (is_pow2) {
-        dst = _bitswap<T, digits>(src);
+        dst = _bitswap<T, binary_digits<T>::value>(src);
     } else {
         for (src >>= 1; src; src >>= 1) {   
             dst <<= 1;
@@ -707,7 +758,7 @@ template <class T, std::size_t N>
 constexpr T _bitswap(T src) noexcept
 {
     static_assert(binary_digits<T>::value, "");
-    constexpr T cnt = N >> 1;
+    constexpr std::size_t cnt = N >> 1;
     constexpr T msk = _bitswap<T, cnt>();
     src = ((src >> cnt) & msk) | ((src << cnt) & ~msk);
     return cnt > 1 ? _bitswap<T, cnt>(src) : src;
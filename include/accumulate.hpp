@@ -12,6 +12,7 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <numeric>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -20,19 +21,23 @@ namespace bit {
 
 
 
-// Status: will not implement?
+// Status: complete
+// Bits are summed as integers: the result is init plus the number of set bits
 template <class InputIt, class T>
 T accumulate(bit_iterator<InputIt> first, bit_iterator<InputIt> last, T init) {
-    (first, last);
-    return init;
+    return init + bit::count(first, last, bit1);
 }
 
-// Status: on hold
+// Status: complete
+// Sums are computed as popcounts, other operations are folded bit by bit
 template <class InputIt, class T, class BinaryOperation>
 T accumulate(bit_iterator<InputIt> first, bit_iterator<InputIt> last, T init,
     BinaryOperation op) {
-    (first, last, op);
-    return init;
+    if constexpr (_is_plus<BinaryOperation>::value) {
+        return init + bit::count(first, last, bit1);
+    } else {
+        return std::accumulate(first, last, init, op);
+    }
 }
 
 // ========================================================================== //
@@ -21,21 +21,39 @@ namespace bit {
 
 
 
-// Status: will not implement? 
+// Status: complete
+// Bits are differences modulo 2: d_first receives the first bit followed by
+// the xor of every pair of adjacent bits, i.e. the transition map of the range
 template <class InputIt, class OutputIt>
-constexpr OutputIt adjacent_difference(bit_iterator<InputIt> first,
-    bit_iterator<InputIt> last, OutputIt d_first) {
-    (first, last);
-    return d_first;
+constexpr bit_iterator<OutputIt> adjacent_difference(
+    bit_iterator<InputIt> first, bit_iterator<InputIt> last,
+    bit_iterator<OutputIt> d_first) {
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+
+    // Computes the transitions word by word, carrying the last bit of each
+    // word into the first bit of the next one
+    word_type carry = 0;
+    return _transform_words(first, last, d_first,
+        [&carry](word_type word, std::size_t len) {
+            const word_type delta = _transitions(word, carry);
+            carry = word >> (len - 1);
+            return delta;
+        }
+    );
 }
 
-// Status: on hold 
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
 bit_iterator<ForwardIt2> adjacent_difference(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> d_first) {
-    (policy, first, last);
-    return d_first; 
+    static_cast<void>(policy);
+    return bit::adjacent_difference(first, last, d_first);
 }
 
 // ========================================================================== //
@@ -19,20 +19,54 @@ namespace bit {
 
 
 
-// Status: to do
+// Status: complete
 template <class ForwardIt>
 constexpr bit_iterator<ForwardIt> adjacent_find(bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last) {
-    (last);
-    return first;    
+
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    using size_type = typename bit_iterator<ForwardIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const size_type total_bits = bit::distance(first, last);
+    bit_iterator<ForwardIt> cursor = first;
+    size_type bits_scanned = 0;
+    word_type carry = 0;
+    word_type word = 0;
+    word_type equal = 0;
+
+    // Bit i of the transition map is zero when bit i equals bit i - 1, the
+    // msb of the previous word being carried in to compare across words
+    while (bits_scanned < total_bits) {
+        const size_type bits_to_read = std::min(
+            total_bits - bits_scanned, digits);
+        word = get_word<word_type>(cursor, bits_to_read);
+        equal = static_cast<word_type>(~_transitions(word, carry));
+        if (bits_scanned == 0) {
+            equal &= static_cast<word_type>(~static_cast<word_type>(1));
+        }
+        if (bits_to_read < digits) {
+            equal &= static_cast<word_type>(
+                (static_cast<word_type>(1) << bits_to_read) - 1);
+        }
+        if (equal) {
+            return first + (bits_scanned + _tzcnt(equal) - 1);
+        }
+        carry = word >> (bits_to_read - 1);
+        bits_scanned += bits_to_read;
+        std::advance(cursor, bits_to_read);
+    }
+    return last;
 }
 
-// Status: to do
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt>
 bit_iterator<ForwardIt> adjacent_find(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last) {
-    (policy, last);
-    return first;
+    static_cast<void>(policy);
+    return bit::adjacent_find(first, last);
 }
 
 // Status: on hold
@@ -0,0 +1,124 @@
+// ================================= ASYNC ================================== //
+// Project: The Experimental Bit Algorithms Library
+// Name: async.hpp
+// Description: Asynchronous variants of the bit algorithms returning futures
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ASYNC_HPP_INCLUDED
+#define _ASYNC_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <utility>
+// Project sources
+#include "execution.hpp"
+// Third-party libraries
+// Miscellaneous
+
+namespace bit {
+namespace async {
+// ========================================================================== //
+
+
+
+// --------------------------------- Launch --------------------------------- //
+// Number of launched functions that have not returned yet
+inline std::atomic<std::size_t>& _pending_tasks() {
+    static std::atomic<std::size_t> pending{0};
+    return pending;
+}
+
+// Runs f on the thread pool of the library and returns the future of its
+// result, holding the exception thrown by f if any. The pool holds at least
+// one worker per hardware thread and per pending function, so that launched
+// functions run concurrently. Algorithms with a parallel policy may be
+// called from f: the pool thread running it takes part in their work
+// instead of blocking. A pipeline of algorithms is launched as a single
+// function calling them in sequence
+template <class Function>
+std::future<std::invoke_result_t<std::decay_t<Function>>> launch(
+    Function&& f) {
+    using result_type = std::invoke_result_t<std::decay_t<Function>>;
+    auto task = std::make_shared<std::packaged_task<result_type()>>(
+        std::forward<Function>(f));
+    std::future<result_type> result = task->get_future();
+    const std::size_t pending = ++_pending_tasks();
+    _thread_pool& pool = _thread_pool::instance();
+    pool.reserve(std::max<std::size_t>(std::thread::hardware_concurrency(),
+        pending));
+    pool.submit([task]{
+        (*task)();
+        --_pending_tasks();
+    });
+    return result;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------- Algorithms ------------------------------- //
+// Every algorithm takes the arguments of its synchronous overloads, policy
+// included, copies them, and returns the future of its result. The ranges
+// must stay valid and unmodified until the future is ready
+
+template <class... Args>
+auto count(Args... args) {
+    return launch([args...]{return bit::count(args...);});
+}
+
+template <class... Args>
+auto find(Args... args) {
+    return launch([args...]{return bit::find(args...);});
+}
+
+template <class... Args>
+auto copy(Args... args) {
+    return launch([args...]{return bit::copy(args...);});
+}
+
+template <class... Args>
+auto fill(Args... args) {
+    return launch([args...]{return bit::fill(args...);});
+}
+
+template <class... Args>
+auto transform(Args... args) {
+    return launch([args...]{return bit::transform(args...);});
+}
+
+template <class... Args>
+auto reverse(Args... args) {
+    return launch([args...]{return bit::reverse(args...);});
+}
+
+template <class... Args>
+auto reduce(Args... args) {
+    return launch([args...]{return bit::reduce(args...);});
+}
+
+template <class... Args>
+auto transform_reduce(Args... args) {
+    return launch([args...]{return bit::transform_reduce(args...);});
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace async
+} // namespace bit
+
+#endif // _ASYNC_HPP_INCLUDED
+// ========================================================================== //
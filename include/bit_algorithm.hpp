@@ -18,6 +18,9 @@
 #include "input_iterator.hpp"
 #include "debug_utils.hpp" //TODO does this belong somewhere else?
 #include "bit_algorithm_details.hpp"
+#include "simd_word.hpp"
+#include "execution.hpp"
+#include "dispatch.hpp"
 // <algorithm> overloads
 #include "all_of.hpp"
 #include "any_of.hpp"
@@ -127,6 +130,12 @@
 #include "destroy_n.hpp"
 #include "qsort.hpp"
 #include "bsearch.hpp"
+// Bit-specific algorithms
+#include "count_ranges.hpp"
+// Bit-specific structures
+#include "rank.hpp"
+// Asynchronous variants
+#include "async.hpp"
 // ========================================================================== //
 #endif // _BIT_ALGORITHM_HPP_INCLUDED
 // ========================================================================== //
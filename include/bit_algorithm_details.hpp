@@ -15,9 +15,19 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <climits>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
 // Project sources
 // Third-party libraries
 // Miscellaneous
+#if __has_include(<version>)
+#include <version>
+#endif
 
 namespace bit {
 
@@ -50,46 +60,588 @@ void advance(bit_iterator<InputIt>& first, Distance n)
 
 
 
+// ----------------------------- Iterator Traits ---------------------------- //
+// Checks whether a type is a bit iterator, to tell execution policies apart
+// from the first iterator of an overload with the same arity
+template <class T>
+struct _is_bit_iterator
+: std::false_type
+{
+};
+
+template <class Iterator>
+struct _is_bit_iterator<bit_iterator<Iterator>>
+: std::true_type
+{
+};
+
+// Checks whether an iterator walks over contiguous memory, so that the
+// address of an element can be computed from the address of the first one:
+// any contiguous iterator in C++20, and otherwise pointers and iterators of
+// vectors of integers
+#if defined(__cpp_lib_concepts)
+template <class Iterator, class = void>
+struct _is_contiguous_iterator
+: std::bool_constant<std::contiguous_iterator<Iterator>>
+{
+};
+#else
+template <class Iterator, class = void>
+struct _is_contiguous_iterator
+: std::is_pointer<Iterator>
+{
+};
+template <class Iterator>
+struct _is_contiguous_iterator<Iterator, std::enable_if_t<
+    std::is_integral<
+        typename std::iterator_traits<Iterator>::value_type>::value
+    && !std::is_same<
+        typename std::iterator_traits<Iterator>::value_type, bool>::value>>
+: std::integral_constant<bool, std::is_pointer<Iterator>::value
+    || std::is_same<Iterator, typename std::vector<
+        typename std::iterator_traits<Iterator>::value_type>::iterator>::value
+    || std::is_same<Iterator, typename std::vector<
+        typename std::iterator_traits<Iterator>::value_type>::const_iterator
+    >::value>
+{
+};
+#endif
+
+// Whether the words of an iterator are contiguous unsigned integers stored
+// in little-endian order, so that their bits follow the bits of their bytes
+// whatever the width of the words
+template <class Iterator>
+struct _is_byte_stream_iterator
+: std::integral_constant<bool,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    _is_contiguous_iterator<Iterator>::value
+    && std::is_unsigned<
+        typename std::iterator_traits<Iterator>::value_type>::value
+#else
+    false
+#endif
+>
+{
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- Function Object Traits ------------------------- //
+// Checks whether an operation is the addition of the standard library, in
+// which case a sum of bits is the number of set bits
+template <class Op>
+struct _is_plus
+: std::false_type
+{
+};
+
+template <class T>
+struct _is_plus<std::plus<T>>
+: std::true_type
+{
+};
+
+// Maps the standard function objects that are well defined on bits to their
+// word-level equivalent
+template <class Op>
+struct _bitwise_operation
+: std::false_type
+{
+};
+
+// Conjunction: bit_and, logical_and and multiplies
+template <class Op>
+struct _bitwise_and
+: std::true_type
+{
+    template <class WordType>
+    static constexpr WordType apply(WordType lhs, WordType rhs) noexcept {
+        return lhs & rhs;
+    }
+};
+template <class T>
+struct _bitwise_operation<std::bit_and<T>>
+: _bitwise_and<std::bit_and<T>>
+{
+};
+template <class T>
+struct _bitwise_operation<std::logical_and<T>>
+: _bitwise_and<std::logical_and<T>>
+{
+};
+template <class T>
+struct _bitwise_operation<std::multiplies<T>>
+: _bitwise_and<std::multiplies<T>>
+{
+};
+
+// Disjunction: bit_or and logical_or
+template <class Op>
+struct _bitwise_or
+: std::true_type
+{
+    template <class WordType>
+    static constexpr WordType apply(WordType lhs, WordType rhs) noexcept {
+        return lhs | rhs;
+    }
+};
+template <class T>
+struct _bitwise_operation<std::bit_or<T>>
+: _bitwise_or<std::bit_or<T>>
+{
+};
+template <class T>
+struct _bitwise_operation<std::logical_or<T>>
+: _bitwise_or<std::logical_or<T>>
+{
+};
+
+// Exclusive disjunction: bit_xor and not_equal_to
+template <class Op>
+struct _bitwise_xor
+: std::true_type
+{
+    template <class WordType>
+    static constexpr WordType apply(WordType lhs, WordType rhs) noexcept {
+        return lhs ^ rhs;
+    }
+};
+template <class T>
+struct _bitwise_operation<std::bit_xor<T>>
+: _bitwise_xor<std::bit_xor<T>>
+{
+};
+template <class T>
+struct _bitwise_operation<std::not_equal_to<T>>
+: _bitwise_xor<std::not_equal_to<T>>
+{
+};
+
+// Equivalence: equal_to
+template <class T>
+struct _bitwise_operation<std::equal_to<T>>
+: std::true_type
+{
+    template <class WordType>
+    static constexpr WordType apply(WordType lhs, WordType rhs) noexcept {
+        return static_cast<WordType>(~(lhs ^ rhs));
+    }
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- Segmented Ranges ---------------------------- //
+// Mask of the bits [first, last) of a word, with first < last <= digits
+template <class WordType>
+constexpr WordType _mask_range(std::size_t first, std::size_t last) noexcept {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    constexpr WordType ones = static_cast<WordType>(~static_cast<WordType>(0));
+    return static_cast<WordType>(static_cast<WordType>(ones << first)
+        & static_cast<WordType>(ones >> (digits - last)));
+}
+
+// The words of a bit range: a head word holding its first bits, unless they
+// start a full word, the full words of the body, and a tail word, the one at
+// the end of the body, holding its last bits unless they end a full word.
+// A range within a single word only has a head and an empty body, and a mask
+// of zero stands for a missing head or tail
+template <class Iterator>
+struct _segmented_range
+{
+    using word_type = std::remove_cv_t<
+        typename bit_iterator<Iterator>::word_type>;
+    Iterator head;
+    word_type head_mask;
+    Iterator body_first;
+    Iterator body_last;
+    word_type tail_mask;
+};
+
+// Splits [first, last) into its head, body and tail
+template <class Iterator>
+constexpr _segmented_range<Iterator> _segment(bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last) {
+    using word_type = typename _segmented_range<Iterator>::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+    _segmented_range<Iterator> range{first.base(), 0, first.base(),
+        last.base(), 0};
+    if (first.base() == last.base()) {
+        if (first.position() != last.position()) {
+            range.head_mask = _mask_range<word_type>(first.position(),
+                last.position());
+        }
+        return range;
+    }
+    if (first.position() != 0) {
+        range.head_mask = _mask_range<word_type>(first.position(), digits);
+        ++range.body_first;
+    }
+    if (last.position() != 0) {
+        range.tail_mask = _mask_range<word_type>(0, last.position());
+    }
+    return range;
+}
+
+// Calls edge(it, mask) on the head and the tail of [first, last), it being
+// the word and mask the bits of the range in it, and body(first, last) on
+// the full words in between if any, in the order of the range: word kernels
+// get the edge cases right without any branch in their loop
+template <class Iterator, class EdgeOperation, class BodyOperation>
+constexpr void _for_each_segment(bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last, EdgeOperation&& edge, BodyOperation&& body) {
+    const _segmented_range<Iterator> range = _segment(first, last);
+    if (range.head_mask) {
+        edge(range.head, range.head_mask);
+    }
+    if (range.body_first != range.body_last) {
+        body(range.body_first, range.body_last);
+    }
+    if (range.tail_mask) {
+        edge(range.body_last, range.tail_mask);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // --------------------------- Utility Functions ---------------------------- //
 
-// Get next len bits beginning at start and store them in a word of type T
+// Get next len bits beginning at start and store them in a word of type T.
+// Contiguous words of type T are read without branches by two loads, the
+// second one loading the first word again when the bits fit in it, in which
+// case its bits are shifted out or masked out
 template <class T, class InputIt>
 T get_word(bit_iterator<InputIt> first, T len=binary_digits<T>::value)
 {
     using native_word_type = typename bit_iterator<InputIt>::word_type;
-    T native_digits = binary_digits<native_word_type>::value; 
-    constexpr T ret_digits = binary_digits<T>::value; 
-    assert(ret_digits >= len);
-    T offset = native_digits - first.position();
-    T ret_word = *first.base() >> first.position();
-
-    // We've already assigned enough bits
-    if (len <= offset) { 
-        return ret_word;
-    } 
+    if constexpr (_is_contiguous_iterator<InputIt>::value
+                  && std::is_unsigned<T>::value
+                  && std::is_same<std::remove_cv_t<native_word_type>, T>::value) {
+        constexpr T digits = binary_digits<T>::value;
+        const T pos = first.position();
+        const T* words = std::addressof(*first.base());
+        const T lo = words[0];
+        const T hi = words[pos + len > digits];
+        const T ones = static_cast<T>(~static_cast<T>(0));
+        const T mask = len == 0
+            ? static_cast<T>(0)
+            : static_cast<T>(ones >> (digits - len));
+        return static_cast<T>((lo >> pos) | (static_cast<T>(
+            static_cast<T>(hi << 1) << (digits - 1 - pos)) & mask));
+    } else {
+        T native_digits = binary_digits<native_word_type>::value; 
+        constexpr T ret_digits = binary_digits<T>::value; 
+        assert(ret_digits >= len);
+        T offset = native_digits - first.position();
+        T ret_word = *first.base() >> first.position();
+
+        // We've already assigned enough bits
+        if (len <= offset) { 
+            return ret_word;
+        } 
 
-    InputIt it = std::next(first.base());
-    len -= offset;
-    // Fill up ret_word starting at bit [offset] using it
-    while (len > native_digits) {
+        InputIt it = std::next(first.base());
+        len -= offset;
+        // Fill up ret_word starting at bit [offset] using it
+        while (len > native_digits) {
+            ret_word = _bitblend(
+                    ret_word,      
+                    static_cast<T>(static_cast<T>(*it) << offset),   
+                    offset,
+                    native_digits
+            );
+            ++it;
+            offset += native_digits;
+            len -= native_digits;
+        }
+        // Assign remaining len bits of last word
         ret_word = _bitblend(
-                ret_word,      
+                ret_word,            
                 static_cast<T>(static_cast<T>(*it) << offset),   
                 offset,
-                native_digits
+                len
+        );
+        return ret_word;
+    }
+}
+
+// Get the next binary_digits<T> bits beginning at start, the length being
+// known at compile time. Contiguous little-endian words are read whatever
+// their width by one unaligned load, and the load of the next byte when the
+// bits do not start at a byte boundary
+template <class T, class InputIt>
+T get_full_word(bit_iterator<InputIt> first)
+{
+    if constexpr (_is_byte_stream_iterator<InputIt>::value
+                  && std::is_unsigned<T>::value) {
+        constexpr std::size_t digits = binary_digits<T>::value;
+        const unsigned char* bytes = reinterpret_cast<const unsigned char*>(
+            std::addressof(*first.base())) + first.position() / CHAR_BIT;
+        const std::size_t shift = first.position() % CHAR_BIT;
+        T word;
+        std::memcpy(&word, bytes, sizeof(T));
+        const T next = bytes[shift != 0 ? sizeof(T) : 0];
+        return static_cast<T>((word >> shift) | static_cast<T>(
+            static_cast<T>(next << 1) << (digits - 1 - shift)));
+    } else {
+        return get_word<T>(first, binary_digits<T>::value);
+    }
+}
+
+
+// Reads [first, last) in chunks of at most one destination word, passes each
+// chunk and its length to op, and writes the resulting len bits to d_first.
+// Chunks are visited in order, so op may carry state from one to the next.
+// Bits of the chunk above len are unspecified and op may leave them dirty.
+template <class InputIt, class OutputIt, class WordOp>
+bit_iterator<OutputIt> _transform_words(bit_iterator<InputIt> first,
+                                        bit_iterator<InputIt> last,
+                                        bit_iterator<OutputIt> d_first,
+                                        WordOp&& op
+)
+{
+    // Types and constants
+    using dst_word_type = typename bit_iterator<OutputIt>::word_type;
+    using dst_size_type = typename bit_iterator<OutputIt>::size_type;
+    constexpr dst_size_type dst_digits = binary_digits<dst_word_type>::value;
+
+    // Initialization
+    dst_size_type total_bits = bit::distance(first, last);
+    if (total_bits == 0) return d_first;
+    auto it = d_first.base();
+    dst_word_type word = 0;
+
+    // d_first is not aligned. Write a partial word to align it
+    if (d_first.position() != 0) {
+        dst_size_type partial_bits = std::min(
+            total_bits,
+            dst_digits - d_first.position()
         );
+        word = op(get_word<dst_word_type>(first, partial_bits), partial_bits);
+        *it = _bitblend(
+            *it,
+            static_cast<dst_word_type>(word << d_first.position()),
+            static_cast<dst_word_type>(d_first.position()),
+            static_cast<dst_word_type>(partial_bits)
+        );
+        total_bits -= partial_bits;
+        if (partial_bits + d_first.position() < dst_digits) {
+            return bit_iterator<OutputIt>(
+                it, d_first.position() + partial_bits
+            );
+        }
+        std::advance(first, partial_bits);
+        ++it;
+    }
+
+    // Full destination words
+    while (total_bits >= dst_digits) {
+        *it = op(get_full_word<dst_word_type>(first), dst_digits);
+        total_bits -= dst_digits;
+        std::advance(first, dst_digits);
         ++it;
-        offset += native_digits;
-        len -= native_digits;
     }
-    // Assign remaining len bits of last word
-    ret_word = _bitblend(
-            ret_word,            
-            static_cast<T>(static_cast<T>(*it) << offset),   
-            offset,
-            len
-    );
-    return ret_word;
+
+    // Partial last word
+    if (total_bits) {
+        word = op(get_word<dst_word_type>(first, total_bits), total_bits);
+        *it = _bitblend(
+            *it,
+            word,
+            static_cast<dst_word_type>(0),
+            static_cast<dst_word_type>(total_bits)
+        );
+    }
+    return bit_iterator<OutputIt>(it, total_bits);
+}
+
+// Returns the transition map of word: bit i is set when bit i differs from
+// bit i - 1, bit 0 being compared to the carried msb of the previous word
+template <class WordType>
+constexpr WordType _transitions(WordType word, WordType carry) noexcept
+{
+    return word ^ static_cast<WordType>((word << 1) | (carry & 1));
+}
+
+// Returns the prefix parity of word: bit i is the xor of bits [0, i], the
+// parity of the previous words being carried in as an inversion
+template <class WordType>
+constexpr WordType _prefix_xor(WordType word, WordType carry) noexcept
+{
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    for (std::size_t shift = 1; shift < digits; shift <<= 1) {
+        word ^= static_cast<WordType>(word << shift);
+    }
+    return word ^ static_cast<WordType>(-static_cast<WordType>(carry & 1));
+}
+
+// Writes to d_first the number of set bits in [first, it) if inclusive is
+// false, or in [first, it] otherwise, for every it in [first, last)
+template <class InputIt, class OutputIt, class T>
+OutputIt _prefix_popcount(bit_iterator<InputIt> first,
+                          bit_iterator<InputIt> last,
+                          OutputIt d_first,
+                          T init,
+                          bool inclusive
+)
+{
+    // Types and constants
+    using word_type = typename bit_iterator<InputIt>::word_type;
+    using size_type = typename bit_iterator<InputIt>::size_type;
+    constexpr size_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    size_type total_bits = bit::distance(first, last);
+    word_type word = 0;
+    size_type len = 0;
+
+    // Streams ranks word by word
+    while (total_bits) {
+        len = std::min(total_bits, digits);
+        word = get_word<word_type>(first, len);
+        for (size_type i = 0; i < len; ++i, word >>= 1) {
+            if (inclusive) {
+                init += word & 1;
+                *d_first = init;
+            } else {
+                *d_first = init;
+                init += word & 1;
+            }
+            ++d_first;
+        }
+        total_bits -= len;
+        std::advance(first, len);
+    }
+    return d_first;
+}
+
+// Counts the set bits of op applied to [first1, last1) and the range
+// beginning at first2, one word at a time without materializing the result
+template <class Op, class InputIt1, class InputIt2>
+typename bit_iterator<InputIt1>::difference_type _count_transform(
+    bit_iterator<InputIt1> first1,
+    bit_iterator<InputIt1> last1,
+    bit_iterator<InputIt2> first2
+)
+{
+    // Types and constants
+    using word_type = typename bit_iterator<InputIt1>::word_type;
+    using other_word_type = typename bit_iterator<InputIt2>::word_type;
+    using size_type = typename bit_iterator<InputIt1>::size_type;
+    using difference_type = typename bit_iterator<InputIt1>::difference_type;
+    using operation = _bitwise_operation<Op>;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr bool is_same_word = std::is_same<
+        typename std::remove_cv<word_type>::type,
+        typename std::remove_cv<other_word_type>::type
+    >::value;
+
+    // Initialization
+    size_type total_bits = bit::distance(first1, last1);
+    difference_type result = 0;
+    word_type word = 0;
+    size_type len = 0;
+
+    // Both ranges are aligned: the body is a plain loop over the words
+    if constexpr (is_same_word) {
+        if (first1.position() == 0 && first2.position() == 0) {
+            auto it1 = first1.base();
+            auto it2 = first2.base();
+            for (; it1 != last1.base(); ++it1, ++it2) {
+                result += _popcnt(static_cast<word_type>(
+                    operation::apply(*it1, *it2)));
+            }
+            first1 = bit_iterator<InputIt1>(it1);
+            first2 = bit_iterator<InputIt2>(it2);
+            total_bits = last1.position();
+        }
+    }
+
+    // Otherwise words are assembled on the fly
+    while (total_bits) {
+        len = std::min(total_bits, digits);
+        word = operation::apply(
+            get_word<word_type>(first1, len),
+            get_word<word_type>(first2, len)
+        );
+        if (len < digits) {
+            word &= static_cast<word_type>(
+                (static_cast<word_type>(1) << len) - 1);
+        }
+        result += _popcnt(word);
+        total_bits -= len;
+        std::advance(first1, len);
+        std::advance(first2, len);
+    }
+    return result;
+}
+
+
+// Carry-save adder: adds three words bit by bit, the sum bits going to low
+// and the carries to high
+template <class WordType>
+constexpr void _csa(WordType& high, WordType& low, WordType a, WordType b, 
+    WordType c) noexcept
+{
+    const WordType u = a ^ b;
+    high = (a & b) | (u & c);
+    low = u ^ c;
+}
+
+// Counts the set bits of the words in [first, last). Random access ranges
+// go through a Harley-Seal tree of carry-save adders, which needs a single
+// popcount per block of 16 words
+template <class Iterator>
+std::ptrdiff_t _popcnt_words(Iterator first, Iterator last)
+{
+    // Types and constants
+    using word_type = typename std::remove_cv<
+        typename std::iterator_traits<Iterator>::value_type>::type;
+    using category = typename std::iterator_traits<Iterator>::iterator_category;
+    constexpr std::ptrdiff_t block = 16;
+
+    // Initialization
+    std::ptrdiff_t result = 0;
+
+    // Blocks of 16 words are reduced to weighted accumulators
+    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                  category>::value) {
+        word_type ones = 0, twos = 0, fours = 0, eights = 0, sixteens = 0;
+        word_type twos_a = 0, twos_b = 0, fours_a = 0, fours_b = 0;
+        word_type eights_a = 0, eights_b = 0;
+        std::ptrdiff_t sixteens_count = 0;
+        for (; last - first >= block; first += block) {
+            _csa(twos_a, ones, ones, first[0], first[1]);
+            _csa(twos_b, ones, ones, first[2], first[3]);
+            _csa(fours_a, twos, twos, twos_a, twos_b);
+            _csa(twos_a, ones, ones, first[4], first[5]);
+            _csa(twos_b, ones, ones, first[6], first[7]);
+            _csa(fours_b, twos, twos, twos_a, twos_b);
+            _csa(eights_a, fours, fours, fours_a, fours_b);
+            _csa(twos_a, ones, ones, first[8], first[9]);
+            _csa(twos_b, ones, ones, first[10], first[11]);
+            _csa(fours_a, twos, twos, twos_a, twos_b);
+            _csa(twos_a, ones, ones, first[12], first[13]);
+            _csa(twos_b, ones, ones, first[14], first[15]);
+            _csa(fours_b, twos, twos, twos_a, twos_b);
+            _csa(eights_b, fours, fours, fours_a, fours_b);
+            _csa(sixteens, eights, eights, eights_a, eights_b);
+            sixteens_count += _popcnt(sixteens);
+        }
+        result = 16 * sixteens_count 
+            + 8 * static_cast<std::ptrdiff_t>(_popcnt(eights))
+            + 4 * static_cast<std::ptrdiff_t>(_popcnt(fours)) 
+            + 2 * static_cast<std::ptrdiff_t>(_popcnt(twos)) 
+            + static_cast<std::ptrdiff_t>(_popcnt(ones));
+    }
+
+    // Remaining words are counted one by one
+    for (; first != last; ++first) {
+        result += _popcnt(static_cast<word_type>(*first));
+    }
+    return result;
 }
 
 
@@ -196,53 +748,15 @@ template <class It>
 typename bit_iterator<It>::word_type _padded_read(bit_iterator<It> first, 
     bit_iterator<It> last, const bit::bit_value bv) {
 
-    using word_type = typename bit_iterator<It>::word_type;
+    using word_type = std::remove_cv_t<typename bit_iterator<It>::word_type>;
 
     constexpr std::size_t num_digits = binary_digits<word_type>::value;
-    const std::size_t first_position = first.position();
-    const std::size_t last_position = last.position();
     const word_type read = *(first.base());
-    constexpr word_type all_ones = _all_ones();
-
-    word_type mask;
-
-    if (_is_aligned_lsb(first)) {
-        if (_in_same_word(first, last)) {
-            // Case 1
-            if (bv == bit0) {
-                mask = _shift_towards_lsb(all_ones, num_digits - last_position);
-                return read & mask;
-            } else {
-                mask = _shift_towards_msb(all_ones, last_position); 
-                return read | mask;
-            }
-        } else {
-            // Case 0
-            return read;
-        }
-    } else {
-        if (!_in_same_word(first, last)) {
-            // Case 2
-            if (bv == bit0) {
-                mask = _shift_towards_msb(all_ones, first_position); 
-                return read & mask;
-            } else {
-                mask = _shift_towards_lsb(all_ones, num_digits - first_position); 
-                return read | mask;
-            }
-        } else {
-            // Case 3
-            if (bv == bit0) {
-                mask = _shift_towards_msb(all_ones, first_position); 
-                mask &= _shift_towards_lsb(all_ones, num_digits - last_position);
-                return read & mask;
-            } else {
-                mask = _shift_towards_lsb(all_ones, num_digits - first_position);
-                mask |= _shift_towards_msb(all_ones, last_position);
-                return read | mask;
-            }
-        } 
-    }
+    const word_type mask = _mask_range<word_type>(first.position(),
+        _in_same_word(first, last) ? last.position() : num_digits);
+    return bv == bit0
+        ? static_cast<word_type>(read & mask)
+        : static_cast<word_type>(read | ~mask);
 }
 
 // -------------------------------------------------------------------------- //
@@ -66,8 +66,26 @@ constexpr bit_iterator<OutputIt> copy(bit_iterator<InputIt> first,
         it++;
     }
 
+    // Full words of contiguous 64-bit words are funnel shifted by vectors
+    if constexpr (_is_kernel_iterator<InputIt>::value
+                  && _is_kernel_iterator<OutputIt>::value) {
+        const dst_size_type words = total_bits_to_copy / dst_digits;
+        _funnel_dispatch(it, first.base(), words, first.position());
+        total_bits_to_copy -= words * dst_digits;
+        it += words;
+        first += words * dst_digits;
+    } else if constexpr (_is_byte_stream_iterator<InputIt>::value
+                         && _is_byte_stream_iterator<OutputIt>::value) {
+        // Other contiguous words, of the same or of different widths, are
+        // loaded from the bytes of the source, or moved if byte-aligned
+        const dst_size_type words = total_bits_to_copy / dst_digits;
+        _stream_copy(it, first.base(), words, first.position());
+        total_bits_to_copy -= words * dst_digits;
+        it += words;
+        first += words * dst_digits;
+    }
     while (total_bits_to_copy >= dst_digits) {
-        *it = get_word<dst_word_type>(first, dst_digits);
+        *it = get_full_word<dst_word_type>(first);
         total_bits_to_copy -= dst_digits;
         it++; 
         std::advance(first, dst_digits);
@@ -83,13 +101,27 @@ constexpr bit_iterator<OutputIt> copy(bit_iterator<InputIt> first,
     return bit::bit_iterator<OutputIt>(it, total_bits_to_copy);
 }
 
-// Status: on hold
+// Status: complete
+// The destination is split at word boundaries and each chunk copies the
+// source bits at the same distance: every destination word, including the
+// partial ones blended at both ends, is written by exactly one worker
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
 bit_iterator<ForwardIt2> copy(ExecutionPolicy&& policy, 
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> d_first) {
-    (policy, first, last);    
-    return d_first;
+    _assert_range_viability(first, last);
+    const bit_iterator<ForwardIt2> d_last = d_first 
+        + bit::distance(first, last);
+    _parallel_for_each_chunk(policy, d_first, d_last,
+        [first, d_first](bit_iterator<ForwardIt2> chunk_first,
+                         bit_iterator<ForwardIt2> chunk_last) {
+            const bit_iterator<ForwardIt1> src_first = first 
+                + bit::distance(d_first, chunk_first);
+            bit::copy(src_first, 
+                src_first + bit::distance(chunk_first, chunk_last), 
+                chunk_first);
+        });
+    return d_last;
 }
 
 // Status: on hold
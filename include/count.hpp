@@ -34,37 +34,18 @@ count(
     _assert_range_viability(first, last);
 
     // Types and constants
-    using word_type = typename bit_iterator<InputIt>::word_type;
+    using word_type = typename _segmented_range<InputIt>::word_type;
     using difference_type = typename bit_iterator<InputIt>::difference_type;
-    constexpr difference_type digits = binary_digits<word_type>::value;
 
-    // Initialization
+    // Computation on the partial words at both ends and the full words
     difference_type result = 0;
-    auto it = first.base();
-    word_type first_value = {};
-    word_type last_value = {};
-
-    // Computation when bits belong to several underlying words
-    if (first.base() != last.base()) {
-        if (first.position() != 0) {
-            first_value = *first.base() >> first.position();
-            result = _popcnt(first_value);
-            ++it;
-        }
-        for (; it != last.base(); ++it) {
-            result += _popcnt(*it);
-        }
-        if (last.position() != 0) {
-            last_value = *last.base() << (digits - last.position());
-            result += _popcnt(last_value);
-        }
-    // Computation when bits belong to the same underlying word
-    } else {
-        result = _popcnt(
-            _bextr<word_type>(*first.base(), first.position(), last.position() 
-              - first.position())
-        );
-    }
+    _for_each_segment(first, last,
+        [&result](InputIt it, word_type mask) {
+            result += _popcnt(static_cast<word_type>(*it & mask));
+        },
+        [&result](InputIt body_first, InputIt body_last) {
+            result += _popcnt_dispatch(body_first, body_last);
+        });
 
     // Negates when the number of zero bits is requested
     if (!static_cast<bool>(value)) {
@@ -75,12 +56,19 @@ count(
     return result;
 }
 
-// Status: to do
-template <class ExecutionPolicy, class ForwardIt, class T>
+// Status: complete
+// Chunks split at cache line boundaries are counted in parallel and their
+// counts summed
+template <class ExecutionPolicy, class ForwardIt>
 typename bit_iterator<ForwardIt>::difference_type count(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last, bit_value value) {
-    (policy, first, last, value);
-    return 0;
+    using difference_type = typename bit_iterator<ForwardIt>::difference_type;
+    _assert_range_viability(first, last);
+    return _parallel_reduce(policy, first, last, difference_type(0),
+        [value](bit_iterator<ForwardIt> chunk_first,
+                bit_iterator<ForwardIt> chunk_last) {
+            return bit::count(chunk_first, chunk_last, value);
+        }, std::plus<difference_type>());
 }
 
 // Status: on hold
@@ -0,0 +1,98 @@
+// ============================== COUNT RANGES ============================== //
+// Project: The Experimental Bit Algorithms Library
+// Name: count_ranges.hpp
+// Description: Number of set bits of many subranges of a bit range at once
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _COUNT_RANGES_HPP_INCLUDED
+#define _COUNT_RANGES_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <vector>
+// Project sources
+#include "bit_algorithm_details.hpp"
+// Third-party libraries
+// Miscellaneous
+
+namespace bit {
+// ========================================================================== //
+
+
+
+// Status: complete
+// Writes to d_first the number of set bits in [first + i, first + j) for
+// every query (i, j) of [q_first, q_last), in order, with 0 <= i <= j <=
+// last - first. The endpoints of the queries are sorted, and the range is
+// swept once, counting the bits between consecutive endpoints: overlapping
+// queries share their counts and no bit is read twice
+template <class ForwardIt, class QueryIt, class OutputIt>
+OutputIt count_ranges(bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last, QueryIt q_first, QueryIt q_last,
+    OutputIt d_first) {
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using difference_type = typename bit_iterator<ForwardIt>::difference_type;
+    using endpoint_type = std::pair<difference_type, std::size_t>;
+
+    // Initialization
+    const difference_type size = bit::distance(first, last);
+    std::vector<endpoint_type> endpoints;
+    std::size_t queries = 0;
+    for (QueryIt query = q_first; query != q_last; ++query, ++queries) {
+        const difference_type start = std::get<0>(*query);
+        const difference_type end = std::get<1>(*query);
+        assert(0 <= start && start <= end && end <= size);
+        static_cast<void>(size);
+        endpoints.emplace_back(start, 2 * queries);
+        endpoints.emplace_back(end, 2 * queries + 1);
+    }
+    std::sort(endpoints.begin(), endpoints.end());
+    std::vector<difference_type> counts(queries, 0);
+
+    // Sweeps the endpoints: a query adds the rank of its end and subtracts
+    // the rank of its start
+    bit_iterator<ForwardIt> it = first;
+    difference_type position = 0;
+    difference_type rank = 0;
+    for (const endpoint_type& endpoint: endpoints) {
+        if (endpoint.first != position) {
+            const bit_iterator<ForwardIt> next = std::next(it,
+                endpoint.first - position);
+            rank += bit::count(it, next, bit1);
+            it = next;
+            position = endpoint.first;
+        }
+        counts[endpoint.second / 2] += endpoint.second % 2 ? rank : -rank;
+    }
+    return std::copy(counts.begin(), counts.end(), d_first);
+}
+
+// Status: complete
+// Queries are read from a range of pairs
+template <class ForwardIt, class Queries, class OutputIt>
+OutputIt count_ranges(bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last, const Queries& queries, OutputIt d_first) {
+    return bit::count_ranges(first, last, std::begin(queries),
+        std::end(queries), d_first);
+}
+
+// ========================================================================== //
+} // namespace bit
+
+#endif // _COUNT_RANGES_HPP_INCLUDED
+// ========================================================================== //
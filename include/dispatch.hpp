@@ -0,0 +1,836 @@
+// ================================ DISPATCH ================================ //
+// Project: The Experimental Bit Algorithms Library
+// Name: dispatch.hpp
+// Description: Runtime selection of the instruction set of the bit kernels
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _DISPATCH_HPP_INCLUDED
+#define _DISPATCH_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+// Project sources
+#include "bit_algorithm_details.hpp"
+#include "execution.hpp"
+// Third-party libraries
+// Miscellaneous
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define _BIT_X86_DISPATCH 1
+#endif
+
+namespace bit {
+// ========================================================================== //
+
+
+
+// ---------------------------- Instruction Sets ---------------------------- //
+// Instruction sets of the kernels, each one including the previous ones:
+// bmi2 stands for popcnt, bmi1 and bmi2, avx512 for its f, bw and vl subsets
+enum class instruction_set: int {
+    scalar = 0,
+    bmi2 = 1,
+    avx2 = 2,
+    avx512 = 3
+};
+
+// Returns the most capable instruction set supported by the processor
+inline instruction_set detected_instruction_set() noexcept {
+    static const instruction_set detected = []{
+        instruction_set result = instruction_set::scalar;
+#if defined(_BIT_X86_DISPATCH)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("popcnt")
+         && __builtin_cpu_supports("bmi")
+         && __builtin_cpu_supports("bmi2")) {
+            result = instruction_set::bmi2;
+            if (__builtin_cpu_supports("avx2")) {
+                result = instruction_set::avx2;
+                if (__builtin_cpu_supports("avx512f")
+                 && __builtin_cpu_supports("avx512bw")
+                 && __builtin_cpu_supports("avx512vl")) {
+                    result = instruction_set::avx512;
+                }
+            }
+        }
+#endif
+        return result;
+    }();
+    return detected;
+}
+
+// Parses the name of an instruction set, returning fallback if unknown
+inline instruction_set _parse_instruction_set(const char* name,
+    instruction_set fallback) noexcept {
+    constexpr const char* names[] = {"scalar", "bmi2", "avx2", "avx512"};
+    for (int i = 0; name && i < 4; ++i) {
+        if (std::strcmp(name, names[i]) == 0) {
+            return static_cast<instruction_set>(i);
+        }
+    }
+    return fallback;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------------------- Kernels --------------------------------- //
+// Unsigned 64-bit words that may alias the words of any underlying range
+#if defined(__GNUC__)
+typedef std::uint64_t __attribute__((__may_alias__)) _word64;
+#else
+typedef std::uint64_t _word64;
+#endif
+
+// Counts the set bits of n words without any specific instruction
+inline std::ptrdiff_t _popcnt_scalar(const _word64* words, std::ptrdiff_t n) {
+    return _popcnt_words(words, words + n);
+}
+
+// Returns the index of the first of the n words at words that differs from
+// skip, or n if there is none
+inline std::ptrdiff_t _find_scalar(const _word64* words, std::ptrdiff_t n,
+    _word64 skip) {
+    std::ptrdiff_t i = 0;
+    while (i < n && words[i] == skip) {
+        ++i;
+    }
+    return i;
+}
+
+// Deposits the low bits of src at the set bits of msk, one set bit of msk
+// per iteration: fast on sparse masks
+inline std::uint64_t _pdep_loop(std::uint64_t src, std::uint64_t msk) {
+    std::uint64_t dst = 0;
+    for (; msk; msk &= msk - 1, src >>= 1) {
+        dst |= msk & (~msk + 1) & (~(src & 1) + 1);
+    }
+    return dst;
+}
+
+// Extracts the bits of src at the set bits of msk to the low bits, one set
+// bit of msk per iteration: fast on sparse masks
+inline std::uint64_t _pext_loop(std::uint64_t src, std::uint64_t msk) {
+    std::uint64_t dst = 0;
+    for (unsigned i = 0; msk; msk &= msk - 1, ++i) {
+        dst |= static_cast<std::uint64_t>((src & msk & (~msk + 1)) != 0) << i;
+    }
+    return dst;
+}
+
+// Returns the prefix xor of the bits of x, from the least significant
+inline std::uint64_t _prefix_xor(std::uint64_t x) {
+    x ^= x << 1;
+    x ^= x << 2;
+    x ^= x << 4;
+    x ^= x << 8;
+    x ^= x << 16;
+    x ^= x << 32;
+    return x;
+}
+
+// Extracts the bits of src at the set bits of msk to the low bits by blocks:
+// the bits are moved right by 1, 2, 4, 8, 16 and 32 positions according to
+// the parity of the number of clear bits of msk below them, in six branchless
+// rounds whatever the mask
+inline std::uint64_t _pext_block(std::uint64_t src, std::uint64_t msk) {
+    std::uint64_t dst = src & msk;
+    std::uint64_t clear = ~msk << 1;
+    for (unsigned i = 0; i < 6; ++i) {
+        const std::uint64_t parity = _prefix_xor(clear);
+        const std::uint64_t moved = parity & msk;
+        const std::uint64_t bits = dst & moved;
+        msk = (msk ^ moved) | (moved >> (1u << i));
+        dst = (dst ^ bits) | (bits >> (1u << i));
+        clear &= ~parity;
+    }
+    return dst;
+}
+
+// Deposits the low bits of src at the set bits of msk by blocks: the moves of
+// _pext_block are computed from the mask, and undone in the reverse order
+inline std::uint64_t _pdep_block(std::uint64_t src, std::uint64_t msk) {
+    std::uint64_t moves[6];
+    std::uint64_t m = msk;
+    std::uint64_t clear = ~m << 1;
+    for (unsigned i = 0; i < 6; ++i) {
+        const std::uint64_t parity = _prefix_xor(clear);
+        moves[i] = parity & m;
+        m = (m ^ moves[i]) | (moves[i] >> (1u << i));
+        clear &= ~parity;
+    }
+    for (unsigned i = 6; i-- > 0;) {
+        src = (src & ~moves[i]) | ((src << (1u << i)) & moves[i]);
+    }
+    return src & msk;
+}
+
+// Deposits and extracts bits without any specific instruction, by a loop on
+// masks with less than 16 set bits, by blocks on denser ones
+inline std::uint64_t _pdep_scalar(std::uint64_t src, std::uint64_t msk) {
+    return _popcnt(msk) < 16 ? _pdep_loop(src, msk) : _pdep_block(src, msk);
+}
+
+inline std::uint64_t _pext_scalar(std::uint64_t src, std::uint64_t msk) {
+    return _popcnt(msk) < 16 ? _pext_loop(src, msk) : _pext_block(src, msk);
+}
+
+// Leaves every word of a reverse to the scalar loop of _reverse_words
+inline void _reverse_scalar(_word64*, std::ptrdiff_t&, std::ptrdiff_t&,
+    _word64&, unsigned) {
+}
+
+// Writes to the n words at dst the words of the bits starting at bit shift of
+// the word at src, with 0 < shift < 64: every word is a funnel shift of two
+// adjacent source words. Going from the first word to the last, dst may
+// overlap src if it is not after it
+inline void _funnel_forward_scalar(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    for (std::ptrdiff_t i = 0; i < n; ++i) {
+        dst[i] = (src[i] >> shift) | (src[i + 1] << (64 - shift));
+    }
+}
+
+// Same as _funnel_forward_scalar, going from the last word to the first, so
+// that dst may overlap src if it is after it
+inline void _funnel_backward_scalar(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    for (std::ptrdiff_t i = n - 1; i >= 0; --i) {
+        dst[i] = (src[i] >> shift) | (src[i + 1] << (64 - shift));
+    }
+}
+
+#if defined(_BIT_X86_DISPATCH)
+// Counts the set bits of n words with the popcnt instruction, using
+// independent accumulators to hide its latency
+__attribute__((target("popcnt")))
+inline std::ptrdiff_t _popcnt_bmi2(const _word64* words, std::ptrdiff_t n) {
+    std::uint64_t counts[4] = {0, 0, 0, 0};
+    std::ptrdiff_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        counts[0] += __builtin_popcountll(words[i]);
+        counts[1] += __builtin_popcountll(words[i + 1]);
+        counts[2] += __builtin_popcountll(words[i + 2]);
+        counts[3] += __builtin_popcountll(words[i + 3]);
+    }
+    for (; i < n; ++i) {
+        counts[0] += __builtin_popcountll(words[i]);
+    }
+    return static_cast<std::ptrdiff_t>(
+        counts[0] + counts[1] + counts[2] + counts[3]);
+}
+
+// Counts the set bits of every 64-bit lane of a vector: the bytes are split
+// in nibbles, counted by a table lookup, and summed per lane
+__attribute__((target("avx2")))
+inline __m256i _popcnt256(__m256i v) {
+    const __m256i lookup = _mm256_setr_epi8(
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+        0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    const __m256i low = _mm256_and_si256(v, nibble);
+    const __m256i high = _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble);
+    const __m256i counts = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, low),
+        _mm256_shuffle_epi8(lookup, high));
+    return _mm256_sad_epu8(counts, _mm256_setzero_si256());
+}
+
+// Carry-save adder of vectors, see _csa
+__attribute__((target("avx2")))
+inline void _csa256(__m256i& high, __m256i& low, __m256i a, __m256i b,
+    __m256i c) {
+    const __m256i u = _mm256_xor_si256(a, b);
+    high = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+    low = _mm256_xor_si256(u, c);
+}
+
+// Counts the set bits of n words with a Harley-Seal tree over blocks of 16
+// vectors, which needs a single lookup count per block. Words before the
+// first 32-byte boundary and after the last full vector are counted one by
+// one, so that every vector load is aligned
+__attribute__((target("avx2,popcnt")))
+inline std::ptrdiff_t _popcnt_avx2(const _word64* words, std::ptrdiff_t n) {
+
+    // Types and constants
+    constexpr std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(_word64);
+    constexpr std::ptrdiff_t block = 16;
+
+    // Head words, up to the first aligned vector
+    const std::ptrdiff_t head = std::min<std::ptrdiff_t>(n,
+        (-static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(words)
+          / sizeof(_word64))) & (lanes - 1));
+    std::ptrdiff_t result = _popcnt_bmi2(words, head);
+    const __m256i* vectors = reinterpret_cast<const __m256i*>(words + head);
+    const std::ptrdiff_t count = (n - head) / lanes;
+
+    // Blocks of 16 vectors are reduced to weighted accumulators
+    __m256i total = _mm256_setzero_si256();
+    __m256i ones = _mm256_setzero_si256(), twos = ones, fours = ones;
+    __m256i eights = ones, sixteens = ones;
+    __m256i twos_a, twos_b, fours_a, fours_b, eights_a, eights_b;
+    std::ptrdiff_t i = 0;
+    for (; i + block <= count; i += block) {
+        const __m256i* v = vectors + i;
+        _csa256(twos_a, ones, ones, _mm256_load_si256(v),
+            _mm256_load_si256(v + 1));
+        _csa256(twos_b, ones, ones, _mm256_load_si256(v + 2),
+            _mm256_load_si256(v + 3));
+        _csa256(fours_a, twos, twos, twos_a, twos_b);
+        _csa256(twos_a, ones, ones, _mm256_load_si256(v + 4),
+            _mm256_load_si256(v + 5));
+        _csa256(twos_b, ones, ones, _mm256_load_si256(v + 6),
+            _mm256_load_si256(v + 7));
+        _csa256(fours_b, twos, twos, twos_a, twos_b);
+        _csa256(eights_a, fours, fours, fours_a, fours_b);
+        _csa256(twos_a, ones, ones, _mm256_load_si256(v + 8),
+            _mm256_load_si256(v + 9));
+        _csa256(twos_b, ones, ones, _mm256_load_si256(v + 10),
+            _mm256_load_si256(v + 11));
+        _csa256(fours_a, twos, twos, twos_a, twos_b);
+        _csa256(twos_a, ones, ones, _mm256_load_si256(v + 12),
+            _mm256_load_si256(v + 13));
+        _csa256(twos_b, ones, ones, _mm256_load_si256(v + 14),
+            _mm256_load_si256(v + 15));
+        _csa256(fours_b, twos, twos, twos_a, twos_b);
+        _csa256(eights_b, fours, fours, fours_a, fours_b);
+        _csa256(sixteens, eights, eights, eights_a, eights_b);
+        total = _mm256_add_epi64(total, _popcnt256(sixteens));
+    }
+    total = _mm256_slli_epi64(total, 4);
+    total = _mm256_add_epi64(total,
+        _mm256_slli_epi64(_popcnt256(eights), 3));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(_popcnt256(fours), 2));
+    total = _mm256_add_epi64(total, _mm256_slli_epi64(_popcnt256(twos), 1));
+    total = _mm256_add_epi64(total, _popcnt256(ones));
+
+    // Remaining vectors and words
+    for (; i < count; ++i) {
+        total = _mm256_add_epi64(total,
+            _popcnt256(_mm256_load_si256(vectors + i)));
+    }
+    result += _mm256_extract_epi64(total, 0) + _mm256_extract_epi64(total, 1)
+            + _mm256_extract_epi64(total, 2) + _mm256_extract_epi64(total, 3);
+    return result + _popcnt_bmi2(words + head + count * lanes,
+        n - head - count * lanes);
+}
+
+// Deposits and extracts bits with the pdep and pext instructions
+__attribute__((target("bmi2")))
+inline std::uint64_t _pdep_bmi2(std::uint64_t src, std::uint64_t msk) {
+    return _pdep_u64(src, msk);
+}
+
+__attribute__((target("bmi2")))
+inline std::uint64_t _pext_bmi2(std::uint64_t src, std::uint64_t msk) {
+    return _pext_u64(src, msk);
+}
+
+// Skips blocks of four vectors equal to skip with a single vptest of the
+// union of their differences, the first block that differs being searched
+// word by word
+__attribute__((target("avx2")))
+inline std::ptrdiff_t _find_avx2(const _word64* words, std::ptrdiff_t n,
+    _word64 skip) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(_word64);
+    constexpr std::ptrdiff_t block = 4 * lanes;
+    const __m256i skips = _mm256_set1_epi64x(static_cast<long long>(skip));
+    const __m256i* vectors = reinterpret_cast<const __m256i*>(words);
+    std::ptrdiff_t i = 0;
+    for (; i + block <= n; i += block, vectors += 4) {
+        const __m256i differences = _mm256_or_si256(
+            _mm256_or_si256(
+                _mm256_xor_si256(_mm256_loadu_si256(vectors), skips),
+                _mm256_xor_si256(_mm256_loadu_si256(vectors + 1), skips)),
+            _mm256_or_si256(
+                _mm256_xor_si256(_mm256_loadu_si256(vectors + 2), skips),
+                _mm256_xor_si256(_mm256_loadu_si256(vectors + 3), skips)));
+        if (!_mm256_testz_si256(differences, differences)) {
+            break;
+        }
+    }
+    return i + _find_scalar(words + i, n - i, skip);
+}
+
+// Reverses the order of the bits of a vector: bytes are reversed within
+// each half, the halves swapped, and the bits of every byte reversed by a
+// lookup of its two nibbles
+__attribute__((target("avx2")))
+inline __m256i _bitswap256(__m256i v) {
+    const __m256i bytes = _mm256_setr_epi8(
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+        15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+    const __m256i reversed = _mm256_setr_epi8(
+        0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+        0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf,
+        0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+        0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+    const __m256i reversed_high = _mm256_slli_epi16(reversed, 4);
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    v = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(v, bytes), 0x4e);
+    return _mm256_or_si256(
+        _mm256_shuffle_epi8(reversed_high, _mm256_and_si256(v, nibble)),
+        _mm256_shuffle_epi8(reversed,
+            _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble)));
+}
+
+// Runs the two-ended loop of _reverse_words by blocks of four words at each
+// end, while they do not meet: the words at the right are funnel shifted
+// with the carried word, the words at the left with their next neighbour,
+// and both blocks are bitswapped as a whole
+__attribute__((target("avx2")))
+inline void _reverse_avx2(_word64* words, std::ptrdiff_t& left,
+    std::ptrdiff_t& right, _word64& carry, unsigned shift) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(_word64);
+    const __m128i low_shift = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i high_shift = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+    for (; left + 2 * lanes <= right; left += lanes, right -= lanes) {
+        _word64* left_words = words + left;
+        _word64* right_words = words + right - lanes;
+        const __m256i a = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(right_words));
+        const __m256i b = _mm256_blend_epi32(
+            _mm256_permute4x64_epi64(a, 0x39),
+            _mm256_set1_epi64x(static_cast<long long>(carry)), 0xc0);
+        const __m256i c = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(left_words));
+        const __m256i d = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(left_words + 1));
+        carry = right_words[0];
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(left_words),
+            _bitswap256(_mm256_or_si256(_mm256_srl_epi64(a, low_shift),
+                _mm256_sll_epi64(b, high_shift))));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(right_words),
+            _bitswap256(_mm256_or_si256(_mm256_srl_epi64(c, low_shift),
+                _mm256_sll_epi64(d, high_shift))));
+    }
+}
+
+// Funnel shifts blocks of four words, the upper neighbours of the source
+// words being read by a second unaligned load. Both loads of a block are
+// done before its store, and blocks never read the words that the previous
+// ones have written
+__attribute__((target("avx2")))
+inline void _funnel_forward_avx2(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(_word64);
+    const __m128i low_shift = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i high_shift = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+    std::ptrdiff_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        const __m256i low = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(src + i));
+        const __m256i high = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(src + i + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i),
+            _mm256_or_si256(_mm256_srl_epi64(low, low_shift),
+                _mm256_sll_epi64(high, high_shift)));
+    }
+    _funnel_forward_scalar(dst + i, src + i, n - i, shift);
+}
+
+// Same as _funnel_forward_avx2, from the last block to the first
+__attribute__((target("avx2")))
+inline void _funnel_backward_avx2(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m256i) / sizeof(_word64);
+    const __m128i low_shift = _mm_cvtsi32_si128(static_cast<int>(shift));
+    const __m128i high_shift = _mm_cvtsi32_si128(static_cast<int>(64 - shift));
+    std::ptrdiff_t i = n;
+    for (; i >= lanes; i -= lanes) {
+        const __m256i low = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(src + i - lanes));
+        const __m256i high = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(src + i - lanes + 1));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i - lanes),
+            _mm256_or_si256(_mm256_srl_epi64(low, low_shift),
+                _mm256_sll_epi64(high, high_shift)));
+    }
+    _funnel_backward_scalar(dst, src, i, shift);
+}
+
+// Funnel shifts blocks of eight words with the vpshrdvq instruction, which
+// shifts the concatenation of each word and its upper neighbour. The last
+// partial block is loaded and stored under a mask
+__attribute__((target("avx512f,avx512vbmi2")))
+inline void _funnel_forward_avx512(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m512i) / sizeof(_word64);
+    const __m512i shifts = _mm512_set1_epi64(static_cast<long long>(shift));
+    std::ptrdiff_t i = 0;
+    for (; i + lanes <= n; i += lanes) {
+        const __m512i low = _mm512_loadu_si512(src + i);
+        const __m512i high = _mm512_loadu_si512(src + i + 1);
+        _mm512_storeu_si512(dst + i, _mm512_shrdv_epi64(low, high, shifts));
+    }
+    const __mmask8 mask = static_cast<__mmask8>((1u << (n - i)) - 1);
+    const __m512i low = _mm512_maskz_loadu_epi64(mask, src + i);
+    const __m512i high = _mm512_maskz_loadu_epi64(mask, src + i + 1);
+    _mm512_mask_storeu_epi64(dst + i, mask,
+        _mm512_shrdv_epi64(low, high, shifts));
+}
+
+// Same as _funnel_forward_avx512, from the last block to the first, the
+// first partial block being the masked one
+__attribute__((target("avx512f,avx512vbmi2")))
+inline void _funnel_backward_avx512(_word64* dst, const _word64* src,
+    std::ptrdiff_t n, unsigned shift) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m512i) / sizeof(_word64);
+    const __m512i shifts = _mm512_set1_epi64(static_cast<long long>(shift));
+    std::ptrdiff_t i = n;
+    for (; i >= lanes; i -= lanes) {
+        const __m512i low = _mm512_loadu_si512(src + i - lanes);
+        const __m512i high = _mm512_loadu_si512(src + i - lanes + 1);
+        _mm512_storeu_si512(dst + i - lanes,
+            _mm512_shrdv_epi64(low, high, shifts));
+    }
+    const __mmask8 mask = static_cast<__mmask8>((1u << i) - 1);
+    const __m512i low = _mm512_maskz_loadu_epi64(mask, src);
+    const __m512i high = _mm512_maskz_loadu_epi64(mask, src + 1);
+    _mm512_mask_storeu_epi64(dst, mask, _mm512_shrdv_epi64(low, high, shifts));
+}
+
+// Skips blocks of four 512-bit vectors equal to skip with a single test of
+// the union of their differences, the first block that differs, or the last
+// partial one, being searched vector by vector under a mask
+__attribute__((target("avx512f")))
+inline std::ptrdiff_t _find_avx512(const _word64* words, std::ptrdiff_t n,
+    _word64 skip) {
+    constexpr std::ptrdiff_t lanes = sizeof(__m512i) / sizeof(_word64);
+    constexpr std::ptrdiff_t block = 4 * lanes;
+    const __m512i skips = _mm512_set1_epi64(static_cast<long long>(skip));
+    std::ptrdiff_t i = 0;
+    for (; i + block <= n; i += block) {
+        const __m512i differences = _mm512_or_si512(
+            _mm512_or_si512(
+                _mm512_xor_si512(_mm512_loadu_si512(words + i), skips),
+                _mm512_xor_si512(_mm512_loadu_si512(words + i + lanes),
+                    skips)),
+            _mm512_or_si512(
+                _mm512_xor_si512(_mm512_loadu_si512(words + i + 2 * lanes),
+                    skips),
+                _mm512_xor_si512(_mm512_loadu_si512(words + i + 3 * lanes),
+                    skips)));
+        if (_mm512_test_epi64_mask(differences, differences)) {
+            break;
+        }
+    }
+    for (; i < n; i += lanes) {
+        const __mmask8 mask = static_cast<__mmask8>(n - i >= lanes
+            ? 0xff : (1u << (n - i)) - 1);
+        const __mmask8 found = _mm512_mask_cmpneq_epi64_mask(mask,
+            _mm512_maskz_loadu_epi64(mask, words + i), skips);
+        if (found) {
+            return i + __builtin_ctz(found);
+        }
+    }
+    return n;
+}
+
+// Counts the set bits of n words with the vpopcntq instruction of 512-bit
+// vectors, four accumulators hiding its latency. The unaligned head and
+// tail are loaded under a mask, so every full vector load is aligned
+__attribute__((target("avx512f,avx512vpopcntdq")))
+inline std::ptrdiff_t _popcnt_avx512(const _word64* words, std::ptrdiff_t n) {
+
+    // Types and constants
+    constexpr std::ptrdiff_t lanes = sizeof(__m512i) / sizeof(_word64);
+
+    // Head words, up to the first aligned vector
+    const std::ptrdiff_t head = std::min<std::ptrdiff_t>(n,
+        (-static_cast<std::ptrdiff_t>(reinterpret_cast<std::uintptr_t>(words)
+          / sizeof(_word64))) & (lanes - 1));
+    __m512i totals[4] = {
+        _mm512_popcnt_epi64(_mm512_maskz_loadu_epi64(
+            static_cast<__mmask8>((1u << head) - 1), words)),
+        _mm512_setzero_si512(), _mm512_setzero_si512(),
+        _mm512_setzero_si512()
+    };
+    const __m512i* vectors = reinterpret_cast<const __m512i*>(words + head);
+    const std::ptrdiff_t count = (n - head) / lanes;
+
+    // Full vectors
+    std::ptrdiff_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        for (std::ptrdiff_t j = 0; j < 4; ++j) {
+            totals[j] = _mm512_add_epi64(totals[j], _mm512_popcnt_epi64(
+                _mm512_load_si512(vectors + i + j)));
+        }
+    }
+    for (; i < count; ++i) {
+        totals[0] = _mm512_add_epi64(totals[0], _mm512_popcnt_epi64(
+            _mm512_load_si512(vectors + i)));
+    }
+
+    // Tail words
+    const std::ptrdiff_t tail = n - head - count * lanes;
+    totals[1] = _mm512_add_epi64(totals[1], _mm512_popcnt_epi64(
+        _mm512_maskz_loadu_epi64(static_cast<__mmask8>((1u << tail) - 1),
+            words + head + count * lanes)));
+    alignas(sizeof(__m512i)) std::uint64_t sums[lanes];
+    _mm512_store_si512(sums, _mm512_add_epi64(
+        _mm512_add_epi64(totals[0], totals[1]),
+        _mm512_add_epi64(totals[2], totals[3])));
+    std::uint64_t result = 0;
+    for (std::ptrdiff_t j = 0; j < lanes; ++j) {
+        result += sums[j];
+    }
+    return static_cast<std::ptrdiff_t>(result);
+}
+#endif
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------------ Kernel Table ------------------------------ //
+// Kernels selected for an instruction set, falling back to the kernels of
+// the previous instruction sets when there is no specific one
+struct _kernel_table {
+    instruction_set isa = instruction_set::scalar;
+    std::ptrdiff_t (*popcnt)(const _word64*, std::ptrdiff_t) = _popcnt_scalar;
+    void (*reverse)(_word64*, std::ptrdiff_t&, std::ptrdiff_t&, _word64&,
+        unsigned) = _reverse_scalar;
+    std::ptrdiff_t (*find)(const _word64*, std::ptrdiff_t, _word64)
+        = _find_scalar;
+    std::uint64_t (*pdep)(std::uint64_t, std::uint64_t) = _pdep_scalar;
+    std::uint64_t (*pext)(std::uint64_t, std::uint64_t) = _pext_scalar;
+    void (*funnel_forward)(_word64*, const _word64*, std::ptrdiff_t,
+        unsigned) = _funnel_forward_scalar;
+    void (*funnel_backward)(_word64*, const _word64*, std::ptrdiff_t,
+        unsigned) = _funnel_backward_scalar;
+};
+
+// Whether pdep and pext run in a few cycles: they are microcoded, with a
+// latency growing with the number of set bits of the mask, before Zen 3
+inline bool _has_fast_pdep() noexcept {
+#if defined(_BIT_X86_DISPATCH)
+    __builtin_cpu_init();
+    return !__builtin_cpu_is("amd")
+        || !(__builtin_cpu_is("znver1") || __builtin_cpu_is("znver2"));
+#else
+    return false;
+#endif
+}
+
+// Builds the table of an instruction set supported by the processor
+inline _kernel_table _make_kernel_table(instruction_set isa) noexcept {
+    _kernel_table table;
+    table.isa = isa;
+#if defined(_BIT_X86_DISPATCH)
+    if (isa >= instruction_set::bmi2) {
+        table.popcnt = _popcnt_bmi2;
+    }
+    if (isa >= instruction_set::bmi2 && _has_fast_pdep()) {
+        table.pdep = _pdep_bmi2;
+        table.pext = _pext_bmi2;
+    }
+    if (isa >= instruction_set::avx2) {
+        table.popcnt = _popcnt_avx2;
+        table.reverse = _reverse_avx2;
+        table.find = _find_avx2;
+        table.funnel_forward = _funnel_forward_avx2;
+        table.funnel_backward = _funnel_backward_avx2;
+    }
+    if (isa >= instruction_set::avx512) {
+        table.find = _find_avx512;
+    }
+    if (isa >= instruction_set::avx512
+     && __builtin_cpu_supports("avx512vpopcntdq")) {
+        table.popcnt = _popcnt_avx512;
+    }
+    if (isa >= instruction_set::avx512
+     && __builtin_cpu_supports("avx512vbmi2")) {
+        table.funnel_forward = _funnel_forward_avx512;
+        table.funnel_backward = _funnel_backward_avx512;
+    }
+#endif
+    return table;
+}
+
+// Table used by the algorithms, selected at the first call from the detected
+// instruction set, lowered by the BIT_INSTRUCTION_SET environment variable
+inline _kernel_table& _kernels() noexcept {
+    static _kernel_table table = []{
+        const instruction_set detected = detected_instruction_set();
+        const instruction_set requested = _parse_instruction_set(
+            std::getenv("BIT_INSTRUCTION_SET"), detected);
+        return _make_kernel_table(std::min(requested, detected));
+    }();
+    return table;
+}
+
+// Returns the instruction set of the kernels in use
+inline instruction_set active_instruction_set() noexcept {
+    return _kernels().isa;
+}
+
+// Selects the kernels of an instruction set, or of the detected one if the
+// processor does not support it, and returns the selected instruction set.
+// No algorithm should be running during the call
+inline instruction_set set_instruction_set(instruction_set isa) noexcept {
+    _kernels() = _make_kernel_table(std::min(isa, detected_instruction_set()));
+    return _kernels().isa;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- Dispatch Details ---------------------------- //
+// Whether the words of an iterator are contiguous 64-bit words, that can be
+// passed to the kernels
+template <class Iterator>
+struct _is_kernel_iterator: std::integral_constant<bool,
+    _is_contiguous_iterator<Iterator>::value
+    && sizeof(typename std::iterator_traits<Iterator>::value_type)
+       == sizeof(std::uint64_t)> {
+};
+
+// Counts the set bits of the words in [first, last), through the kernel table
+// when they are contiguous 64-bit words
+template <class Iterator>
+std::ptrdiff_t _popcnt_dispatch(Iterator first, Iterator last) {
+    if constexpr (_is_kernel_iterator<Iterator>::value) {
+        const std::ptrdiff_t n = std::distance(first, last);
+        return n > 0
+            ? _kernels().popcnt(reinterpret_cast<const _word64*>(
+                std::addressof(*first)), n)
+            : 0;
+    } else {
+        return _popcnt_words(first, last);
+    }
+}
+
+// Returns the index of the first of the n words from first holding a bit of
+// value bv, or n if there is none, through the kernel table. The iterator
+// must be a kernel iterator
+template <class Iterator>
+std::ptrdiff_t _find_dispatch(Iterator first, std::ptrdiff_t n, bit_value bv) {
+    return n > 0
+        ? _kernels().find(reinterpret_cast<const _word64*>(
+            std::addressof(*first)), n, bv == bit1 ? _word64() : ~_word64())
+        : 0;
+}
+
+// Returns the position of the bit of rank r among the set bits of a word,
+// with r lower than its number of set bits, by depositing a single bit
+inline unsigned _select_dispatch(std::uint64_t word, unsigned r) {
+    return static_cast<unsigned>(_tzcnt(
+        _kernels().pdep(std::uint64_t(1) << r, word)));
+}
+
+// Writes to the n words from dst the words of the bits starting at bit shift
+// of the word at src, the word after the last one being read if shift is not
+// zero. Both iterators must be kernel iterators, and dst may overlap src
+template <class OutputIt, class InputIt>
+void _funnel_dispatch(OutputIt dst, InputIt src, std::ptrdiff_t n,
+    unsigned shift) {
+    if (n <= 0) return;
+    _word64* d = reinterpret_cast<_word64*>(std::addressof(*dst));
+    const _word64* s = reinterpret_cast<const _word64*>(std::addressof(*src));
+    if (shift == 0) {
+        std::memmove(d, s, n * sizeof(_word64));
+    } else if (d <= s) {
+        _kernels().funnel_forward(d, s, n, shift);
+    } else {
+        _kernels().funnel_backward(d, s, n, shift);
+    }
+}
+
+// Writes to the n words from dst the bits starting at bit shift of the bytes
+// at src, whatever the width of the words on both sides: bytes are moved at
+// once when the bits are byte-aligned, and otherwise are funnel shifted by
+// unaligned 64-bit loads and stores. Both iterators must be byte stream
+// iterators, and dst may overlap src if it does not follow it
+template <class OutputIt, class InputIt>
+void _stream_copy(OutputIt dst, InputIt src, std::ptrdiff_t n,
+    std::size_t shift) {
+    using word_type = typename std::iterator_traits<OutputIt>::value_type;
+    constexpr std::size_t digits = binary_digits<std::uint64_t>::value;
+    constexpr std::size_t step = sizeof(std::uint64_t);
+    if (n <= 0) return;
+    unsigned char* d = reinterpret_cast<unsigned char*>(std::addressof(*dst));
+    const unsigned char* s = reinterpret_cast<const unsigned char*>(
+        std::addressof(*src)) + shift / CHAR_BIT;
+    const std::size_t bytes = n * sizeof(word_type);
+    std::size_t i = 0;
+    shift %= CHAR_BIT;
+    if (shift == 0) {
+        std::memmove(d, s, bytes);
+        return;
+    }
+    for (; i + step <= bytes; i += step) {
+        std::uint64_t word;
+        std::memcpy(&word, s + i, step);
+        word = (word >> shift)
+            | (static_cast<std::uint64_t>(s[i + step]) << (digits - shift));
+        std::memcpy(d + i, &word, step);
+    }
+    for (; i < bytes; ++i) {
+        d[i] = static_cast<unsigned char>(
+            (s[i] >> shift) | (s[i + 1] << (CHAR_BIT - shift)));
+    }
+}
+
+// Address of the byte holding the bit pointed to by a bit iterator over a
+// byte stream iterator, the bit being the first bit of the byte if its
+// position is a multiple of the byte width
+template <class Iterator>
+const unsigned char* _byte_address(bit_iterator<Iterator> it) {
+    return reinterpret_cast<const unsigned char*>(std::addressof(*it.base()))
+        + it.position() / CHAR_BIT;
+}
+
+// Number of equal bytes at the beginning of the n bytes at both addresses,
+// found with memcmp by blocks: the bytes after it include the first byte
+// that differs, if any, at a distance of less than a block
+inline std::size_t _common_prefix_bytes(const unsigned char* s1,
+    const unsigned char* s2, std::size_t n) {
+    constexpr std::size_t block = 256;
+    std::size_t i = 0;
+    while (i + block <= n && std::memcmp(s1 + i, s2 + i, block) == 0) {
+        i += block;
+    }
+    return i;
+}
+
+// Sets every bit of the words in [first, last) to bv: the bytes of the words
+// then all have the same value, and contiguous integer words are set with
+// memset, other words such as simd words being assigned
+template <class ForwardIt>
+void _fill_words(ForwardIt first, ForwardIt last, bit_value bv) {
+    using word_type = typename std::iterator_traits<ForwardIt>::value_type;
+    if constexpr (_is_contiguous_iterator<ForwardIt>::value
+                  && std::is_integral<word_type>::value) {
+        const std::ptrdiff_t n = std::distance(first, last);
+        if (n > 0) {
+            std::memset(std::addressof(*first), bv == bit1 ? UCHAR_MAX : 0,
+                n * sizeof(word_type));
+        }
+    } else {
+        std::fill(first, last, bv == bit1
+            ? static_cast<word_type>(_all_ones())
+            : static_cast<word_type>(_all_zeros()));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+
+#endif // _DISPATCH_HPP_INCLUDED
+// ========================================================================== //
@@ -12,6 +12,8 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <climits>
+#include <cstring>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -21,16 +23,61 @@ namespace bit {
 
 
 
-// Status: to do
+// Status: complete
+// Byte-aligned contiguous words are compared with memcmp whatever their
+// widths, and the other bits by words of the first range
 template <class InputIt1, class InputIt2>
-constexpr bool equal(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last, 
+constexpr bool equal(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2) {
-    (first1, last, first2); 
+
+    // Assertions
+    _assert_range_viability(first1, last1);
+
+    // Types and constants
+    using word_type = typename bit_iterator<InputIt1>::word_type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+
+    // Initialization
+    std::size_t n = bit::distance(first1, last1);
+
+    // Byte-aligned bytes of contiguous words
+    if constexpr (_is_byte_stream_iterator<InputIt1>::value
+                  && _is_byte_stream_iterator<InputIt2>::value) {
+        const std::size_t bytes = n / CHAR_BIT;
+        if (first1.position() % CHAR_BIT == 0
+            && first2.position() % CHAR_BIT == 0 && bytes != 0) {
+            if (std::memcmp(_byte_address(first1), _byte_address(first2),
+                    bytes) != 0) {
+                return false;
+            }
+            std::advance(first1, bytes * CHAR_BIT);
+            std::advance(first2, bytes * CHAR_BIT);
+            n -= bytes * CHAR_BIT;
+        }
+    }
+
+    // Full words and last partial word
+    for (; n >= digits; n -= digits) {
+        if (get_full_word<word_type>(first1)
+            != get_full_word<word_type>(first2)) {
+            return false;
+        }
+        std::advance(first1, digits);
+        std::advance(first2, digits);
+    }
+    if (n != 0) {
+        const word_type mask = static_cast<word_type>(
+            (static_cast<word_type>(1) << n) - 1);
+        return static_cast<word_type>((get_word<word_type>(first1, n)
+            ^ get_word<word_type>(first2, n)) & mask) == 0;
+    }
     return true;
 }
 
 // Status: to do
-template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
+template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2,
+    class = std::enable_if_t<
+        !_is_bit_iterator<std::decay_t<ExecutionPolicy>>::value>>
 bool equal(ExecutionPolicy&& policy, bit_iterator<ForwardIt1> first1,
     bit_iterator<ForwardIt1> last1, bit_iterator<ForwardIt2> first2) {
     (policy, first1, last1, first2);
@@ -49,21 +96,23 @@ constexpr bool equal(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2,
     class BinaryPredicate> bool equal(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first1, bit_iterator<ForwardIt1> last1,
-    BinaryPredicate p) {
-    (policy, first1, last1, p);
+    bit_iterator<ForwardIt2> first2, BinaryPredicate p) {
+    (policy, first1, last1, first2, p);
     return true;
 }
 
-// Status: on hold
+// Status: complete
 template <class InputIt1, class InputIt2>
 constexpr bool equal(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2, bit_iterator<InputIt2> last2) {
-    (first1, last1, first2, last2);
-    return true;
+    return bit::distance(first1, last1) == bit::distance(first2, last2)
+        && bit::equal(first1, last1, first2);
 }
 
 // Status: to do
-template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
+template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2,
+    class = std::enable_if_t<
+        !_is_bit_iterator<std::decay_t<ExecutionPolicy>>::value>>
 bool equal(ExecutionPolicy&& policy, bit_iterator<ForwardIt1> first1,
     bit_iterator<ForwardIt1> last1, bit_iterator<ForwardIt2> first2,
     bit_iterator<ForwardIt2> last2) {
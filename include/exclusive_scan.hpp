@@ -21,21 +21,47 @@ namespace bit {
 
 
 
-// Status: will not implement?
+// Status: complete
+// Bits are summed modulo 2: d_first receives the parity of the bits before
+// each position, starting from init
 template <class InputIt, class OutputIt, class T>
 bit_iterator<OutputIt> exclusive_scan(bit_iterator<InputIt> first,
     bit_iterator<InputIt> last, bit_iterator<OutputIt> d_first, T init) {
-    (first, last, init);
-    return d_first;
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+
+    // Computes the parity of each word and carries it to the next one
+    word_type carry = static_cast<bool>(init);
+    return _transform_words(first, last, d_first,
+        [&carry](word_type word, std::size_t len) {
+            const word_type parity = _prefix_xor(word, carry);
+            carry = parity >> (len - 1);
+            return static_cast<word_type>(parity ^ word);
+        }
+    );
 }
 
-// Status: will not implement?
+// Status: complete
+// Non-bit outputs receive init plus the number of set bits before each
+// position
+template <class InputIt, class OutputIt, class T>
+OutputIt exclusive_scan(bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last, OutputIt d_first, T init) {
+    _assert_range_viability(first, last);
+    return _prefix_popcount(first, last, d_first, init, false);
+}
+
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
 bit_iterator<ForwardIt2> exclusive_scan(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> d_first, T init) {
-    (policy, first, last, init); 
-    return d_first;
+    static_cast<void>(policy);
+    return bit::exclusive_scan(first, last, d_first, init);
 }
 
 // Status: on hold
@@ -0,0 +1,424 @@
+// =============================== EXECUTION ================================ //
+// Project: The Experimental Bit Algorithms Library
+// Name: execution.hpp
+// Description: Execution policies and the parallel executor of bit algorithms
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EXECUTION_HPP_INCLUDED
+#define _EXECUTION_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+// Project sources
+// Third-party libraries
+// Miscellaneous
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define _BIT_NON_TEMPORAL_STORES 1
+#endif
+#if __has_include(<unistd.h>)
+#include <unistd.h>
+#endif
+
+namespace bit {
+namespace execution {
+// ========================================================================== //
+
+
+
+// --------------------------- Execution Policies --------------------------- //
+// The policies of the standard library need a TBB backend with libstdc++,
+// the bit algorithms provide their own. Any other policy type is accepted by
+// the overloads and runs sequentially
+
+// Sequential execution, equivalent to the overloads without a policy
+struct sequenced_policy {
+};
+
+// Parallel execution on the internal thread pool, using as many threads as
+// the hardware provides unless a concurrency is given: par(4)
+struct parallel_policy {
+    constexpr parallel_policy operator()(std::size_t n) const noexcept {
+        return parallel_policy{n};
+    }
+    std::size_t concurrency = 0;
+};
+
+// Parallel execution that may also be vectorized
+struct parallel_unsequenced_policy {
+    constexpr parallel_unsequenced_policy operator()(
+        std::size_t n) const noexcept {
+        return parallel_unsequenced_policy{n};
+    }
+    std::size_t concurrency = 0;
+};
+
+// Policy objects
+inline constexpr sequenced_policy seq{};
+inline constexpr parallel_policy par{};
+inline constexpr parallel_unsequenced_policy par_unseq{};
+
+// Checks whether a type is one of the policies above
+template <class T>
+struct is_execution_policy
+: std::false_type
+{
+};
+template <>
+struct is_execution_policy<sequenced_policy>
+: std::true_type
+{
+};
+template <>
+struct is_execution_policy<parallel_policy>
+: std::true_type
+{
+};
+template <>
+struct is_execution_policy<parallel_unsequenced_policy>
+: std::true_type
+{
+};
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace execution
+
+
+
+// ------------------------------ Thread Pool ------------------------------- //
+// A process-wide pool of worker threads fed from a single queue. The thread
+// submitting a job works on it as well, so the pool holds one thread less
+// than the requested concurrency, and grows on demand
+class _thread_pool
+{
+    public:
+    static _thread_pool& instance() {
+        static _thread_pool pool;
+        return pool;
+    }
+    _thread_pool(const _thread_pool&) = delete;
+    _thread_pool& operator=(const _thread_pool&) = delete;
+    ~_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _ready.notify_all();
+        for (std::thread& worker: _workers) {
+            worker.join();
+        }
+    }
+
+    // Makes sure that at least n workers are running
+    void reserve(std::size_t n) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (_workers.size() < n) {
+            _workers.emplace_back([this]{_work();});
+        }
+    }
+
+    // Queues a task for the next available worker
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _tasks.push_back(std::move(task));
+        }
+        _ready.notify_one();
+    }
+
+    private:
+    _thread_pool() = default;
+    void _work() {
+        std::function<void()> task;
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _ready.wait(lock, [this]{return _stop || !_tasks.empty();});
+                if (_tasks.empty()) {
+                    return;
+                }
+                task = std::move(_tasks.front());
+                _tasks.pop_front();
+            }
+            task();
+        }
+    }
+    std::mutex _mutex;
+    std::condition_variable _ready;
+    std::deque<std::function<void()>> _tasks;
+    std::vector<std::thread> _workers;
+    bool _stop = false;
+};
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- Executor Details ---------------------------- //
+// Number of bytes of a cache line, chunks never share one
+constexpr std::size_t _cache_line_size = 64;
+
+// Minimal number of bytes processed by a chunk, below which spawning work
+// costs more than it saves
+constexpr std::size_t _min_chunk_size = 4096;
+
+// Number of chunks per thread, to balance uneven workloads
+constexpr std::size_t _chunks_per_thread = 4;
+
+// Number of threads requested by a policy: one unless it is parallel
+template <class ExecutionPolicy>
+std::size_t _concurrency(const ExecutionPolicy& policy) {
+    using policy_type = std::decay_t<ExecutionPolicy>;
+    if constexpr (std::is_same<policy_type,
+                               execution::parallel_policy>::value
+               || std::is_same<policy_type,
+                               execution::parallel_unsequenced_policy>::value) {
+        const std::size_t hardware = std::thread::hardware_concurrency();
+        return policy.concurrency
+            ? policy.concurrency
+            : std::max(hardware, std::size_t(1));
+    } else {
+        static_cast<void>(policy);
+        return 1;
+    }
+}
+
+// Calls f(i) for every i in [0, count) using up to concurrency threads, the
+// calling thread included, and rethrows the first exception raised
+template <class Function>
+void _parallel_for(std::size_t count, std::size_t concurrency, Function&& f) {
+
+    // Nothing to run: no worker is woken up
+    if (count == 0) return;
+
+    // Job shared with the workers, which may start after it completed
+    struct job {
+        std::atomic<std::size_t> next{0};
+        std::size_t done = 0;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+    std::shared_ptr<job> state = std::make_shared<job>();
+
+    // Claims and runs tasks until there are none left: a worker that starts
+    // late claims nothing and never touches f
+    auto run = [state, count, &f]() {
+        for (std::size_t i = state->next++; i < count; i = state->next++) {
+            std::exception_ptr error;
+            try {
+                f(i);
+            } catch (...) {
+                error = std::current_exception();
+            }
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (error && !state->error) {
+                state->error = error;
+            }
+            if (++state->done == count) {
+                state->finished.notify_all();
+            }
+        }
+    };
+
+    // Dispatches the tasks and waits for all of them to be done
+    const std::size_t helpers = std::min(concurrency, count) - 1;
+    if (helpers) {
+        _thread_pool& pool = _thread_pool::instance();
+        pool.reserve(helpers);
+        for (std::size_t i = 0; i < helpers; ++i) {
+            pool.submit(run);
+        }
+    }
+    run();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->finished.wait(lock, [&]{return state->done == count;});
+    if (state->error) {
+        std::rethrow_exception(state->error);
+    }
+}
+
+// Splits a bit range into chunks whose inner boundaries are at the start of
+// a cache line: every underlying word, and every cache line, belongs to a
+// single chunk. Returns the boundaries, from first to last
+template <class Iterator>
+std::vector<bit_iterator<Iterator>> _partition(bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last, std::size_t concurrency) {
+
+    // Types and constants
+    using word_type = typename bit_iterator<Iterator>::word_type;
+    using difference_type = typename bit_iterator<Iterator>::difference_type;
+    using category = typename bit_iterator<Iterator>::iterator_category;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+    constexpr difference_type line_words = std::max(
+        _cache_line_size / sizeof(word_type), std::size_t(1));
+    constexpr difference_type min_words = std::max(
+        _min_chunk_size / sizeof(word_type), std::size_t(1));
+
+    // Initialization
+    std::vector<bit_iterator<Iterator>> bounds(1, first);
+    const difference_type n = bit::distance(first, last);
+    const difference_type position = first.position();
+    const difference_type words = (n + position + digits - 1) / digits;
+    const difference_type max_chunks = concurrency * _chunks_per_thread;
+
+    // Computes word aligned boundaries when the range is worth splitting
+    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                  category>::value) {
+        if (concurrency > 1 && words >= 2 * min_words) {
+            difference_type chunk_words = std::max(
+                (words + max_chunks - 1) / max_chunks, min_words);
+            chunk_words = (chunk_words + line_words - 1)
+                / line_words * line_words;
+            const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(
+                std::addressof(*first.base()));
+            const difference_type offset = static_cast<difference_type>(
+                address / sizeof(word_type) % line_words);
+            for (difference_type k = chunk_words - offset;
+                 k * digits - position < n; k += chunk_words) {
+                if (k > 0) {
+                    bounds.emplace_back(first.base() + k, 0);
+                }
+            }
+        }
+    }
+
+    // Finalization
+    bounds.push_back(last);
+    return bounds;
+}
+
+// Applies kernel(chunk_first, chunk_last) to the chunks of [first, last) in
+// parallel, and folds init with their results, in order, using combine
+template <class ExecutionPolicy, class Iterator, class T, class Kernel,
+    class Combine>
+T _parallel_reduce(const ExecutionPolicy& policy, bit_iterator<Iterator> first,
+    bit_iterator<Iterator> last, T init, Kernel&& kernel, Combine&& combine) {
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, last, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    if (chunks == 1) {
+        return combine(std::move(init), kernel(first, last));
+    }
+    using result_type = std::decay_t<decltype(kernel(first, last))>;
+    std::unique_ptr<result_type[]> results(new result_type[chunks]);
+    _parallel_for(chunks, concurrency, [&](std::size_t i) {
+        results[i] = kernel(bounds[i], bounds[i + 1]);
+    });
+    for (std::size_t i = 0; i < chunks; ++i) {
+        init = combine(std::move(init), std::move(results[i]));
+    }
+    return init;
+}
+
+// Applies kernel(chunk_first, chunk_last) to the chunks of [first, last) in
+// parallel
+template <class ExecutionPolicy, class Iterator, class Kernel>
+void _parallel_for_each_chunk(const ExecutionPolicy& policy,
+    bit_iterator<Iterator> first, bit_iterator<Iterator> last,
+    Kernel&& kernel) {
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, last, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    if (chunks == 1) {
+        kernel(first, last);
+    } else {
+        _parallel_for(chunks, concurrency, [&](std::size_t i) {
+            kernel(bounds[i], bounds[i + 1]);
+        });
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ---------------------------- Non-Temporal Stores ------------------------- //
+// Checks whether words of an output range can be written with non-temporal
+// stores, which bypass the caches and skip the read for ownership
+template <class Iterator>
+struct _is_streamable
+: std::integral_constant<bool,
+#if defined(_BIT_NON_TEMPORAL_STORES)
+    _is_contiguous_iterator<Iterator>::value
+    && (sizeof(typename std::iterator_traits<Iterator>::value_type) == 4
+     || sizeof(typename std::iterator_traits<Iterator>::value_type) == 8)
+#else
+    false
+#endif
+>
+{
+};
+
+// Number of bytes of output above which parallel algorithms stream their
+// writes: the size of the last level cache when the system reports it. The
+// threshold can be changed at runtime, when no algorithm is running
+inline std::size_t& _non_temporal_threshold() {
+    static std::size_t threshold = []{
+        long size = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+        size = sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        return size > 0
+            ? static_cast<std::size_t>(size)
+            : std::size_t(32) << 20;
+    }();
+    return threshold;
+}
+
+// Writes a word without bringing its cache line in the caches
+template <class WordType>
+void _stream_store(WordType* address, WordType value) noexcept {
+#if defined(_BIT_NON_TEMPORAL_STORES)
+    if constexpr (sizeof(WordType) == 8) {
+        _mm_stream_si64(reinterpret_cast<long long*>(address),
+            static_cast<long long>(value));
+    } else if constexpr (sizeof(WordType) == 4) {
+        _mm_stream_si32(reinterpret_cast<int*>(address),
+            static_cast<int>(value));
+    } else {
+        *address = value;
+    }
+#else
+    *address = value;
+#endif
+}
+
+// Orders the streamed stores of the calling thread before its later stores,
+// and must be called before the streamed words are handed to another thread
+inline void _stream_fence() noexcept {
+#if defined(_BIT_NON_TEMPORAL_STORES)
+    _mm_sfence();
+#endif
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+
+#endif // _EXECUTION_HPP_INCLUDED
+// ========================================================================== //
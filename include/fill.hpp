@@ -23,34 +23,45 @@ namespace bit {
 
 
 
-// Status: needs revisions
+// Status: complete
 template <class ForwardIt>
 void fill(bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last, 
     bit::bit_value bv) {
-    bit_iterator<ForwardIt> cur = first;
-
-    using word_type = typename bit_iterator<ForwardIt>::word_type;
-    constexpr std::size_t num_digits = bit::binary_digits<word_type>::value;
-
-    while (cur != last) {
-        if (last - cur >= num_digits) { // at least a full word remains
-            if (bv == bit1) {
-                *(cur.base()) = -1;
-            } else {
-                *(cur.base()) = 0;
-            }
-        } else {
-            set_in_range(cur, last - 1, cur.base(), bv);
-            cur = last;
-        }
-    }
+
+    // Assertions
+    _assert_range_viability(first, last);
+    if (first == last) return;
+
+    // Types and constants
+    using word_type = typename _segmented_range<ForwardIt>::word_type;
+
+    // Partial words at both ends, and full words with memset on contiguous
+    // words
+    _for_each_segment(first, last,
+        [bv](ForwardIt it, word_type mask) {
+            *it = bv == bit1
+                ? static_cast<word_type>(*it | mask)
+                : static_cast<word_type>(*it & ~mask);
+        },
+        [bv](ForwardIt body_first, ForwardIt body_last) {
+            _fill_words(body_first, body_last, bv);
+        });
 }
 
-// Status: to do
+// Status: complete
+// Inner chunk boundaries are word aligned: the partial words at both ends
+// are blended by the first and last chunks only, and every other word is
+// written by exactly one worker
 template <class ExecutionPolicy, class ForwardIt>
 void fill(ExecutionPolicy&& policy, bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last, const bit_value& bv) {
-    (policy, first, last, bv);
+    _assert_range_viability(first, last);
+    const bit_value value = bv;
+    _parallel_for_each_chunk(policy, first, last, 
+        [value](bit_iterator<ForwardIt> chunk_first,
+                bit_iterator<ForwardIt> chunk_last) {
+            bit::fill(chunk_first, chunk_last, value);
+        });
 }
 
 
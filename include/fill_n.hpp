@@ -22,20 +22,22 @@ namespace bit {
 
 
 
-// Status: to do
+// Status: complete
 template <class OutputIt, class Size>
 constexpr bit_iterator<OutputIt> fill_n(bit_iterator<OutputIt> first, Size count, 
     const bit_value& bv) {
   bit_iterator<OutputIt> last = first + count;
   bit::fill(first, last, bv); 
+  return last;
 }
 
-// Status: to do
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt, class Size>
 bit_iterator<ForwardIt> fill_n(ExecutionPolicy&& policy, 
     bit_iterator<ForwardIt> first, Size count, const bit_value& bv) {
-  (bv, policy, count);
-  return first;
+  bit_iterator<ForwardIt> last = first + count;
+  bit::fill(policy, first, last, bv); 
+  return last;
 }
 
 // ========================================================================== //
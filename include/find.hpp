@@ -12,6 +12,8 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <atomic>
+#include <climits>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -19,6 +21,8 @@
 namespace bit {
 
 // Status: needs revisions
+// Contiguous 64-bit words are skipped by blocks of vectors before the first
+// word holding a bit of value bv is searched
 template <class InputIt>
 constexpr bit_iterator<InputIt> find(bit_iterator<InputIt> first,
     bit_iterator<InputIt> last, bit::bit_value bv) {
@@ -28,12 +32,36 @@ constexpr bit_iterator<InputIt> find(bit_iterator<InputIt> first,
 
     bit_iterator<InputIt> cursor = first;
     std::size_t bits_scanned = 0;
+    std::size_t bits_remaining = bit::distance(first, last);
+
+    // Contiguous 64-bit words: once the cursor is aligned, the kernels skip
+    // the words without any bit of value bv by blocks of vectors
+    if constexpr (_is_kernel_iterator<InputIt>::value) {
+        if (cursor.position() != 0 && bits_remaining >= word_type_digits) {
+            const std::size_t bits_to_read = word_type_digits 
+                - cursor.position();
+            const word_type cur = get_word<word_type>(cursor, bits_to_read);
+            const std::size_t num_trailing_complementary_bits = (bv == bit0)
+                ? _tzcnt(static_cast<word_type>(~cur))
+                : _tzcnt(static_cast<word_type>(cur));
+            if (num_trailing_complementary_bits < bits_to_read) {
+                return first + num_trailing_complementary_bits;
+            }
+            bits_scanned += bits_to_read;
+            bits_remaining -= bits_to_read;
+            cursor = cursor + bits_to_read;
+        }
+        const std::size_t skipped = word_type_digits * _find_dispatch(
+            cursor.base(), bits_remaining / word_type_digits, bv);
+        bits_scanned += skipped;
+        bits_remaining -= skipped;
+        cursor = cursor + skipped;
+    }
 
-    while (cursor != last) {
-        std::size_t bits_to_read = std::min(
-            static_cast<std::size_t>(last - cursor), word_type_digits);
+    while (bits_remaining) {
+        std::size_t bits_to_read = std::min(bits_remaining, word_type_digits);
 
-        word_type cur = get_word(cursor, bits_to_read); 
+        word_type cur = get_word<word_type>(cursor, bits_to_read); 
 
         std::size_t num_trailing_complementary_bits = (bv == bit0) 
             ? _tzcnt(static_cast<word_type>(~cur))
@@ -44,7 +72,8 @@ constexpr bit_iterator<InputIt> find(bit_iterator<InputIt> first,
             break;
         } else {
             bits_scanned += bits_to_read;
-            std::advance(cursor, bits_to_read);
+            bits_remaining -= bits_to_read;
+            cursor = cursor + bits_to_read;
         }
     }
 
@@ -59,12 +88,55 @@ constexpr bit_iterator<InputIt> find(bit_iterator<InputIt> first,
 }
 
 
-// Status: to do
+// Status: complete
+// Chunks are claimed in order of position and scanned slice by slice. The
+// lowest chunk holding a match is published, and chunks past it are skipped
+// or abandoned between two slices, so the tail is not scanned once a match
+// is known
 template <class ExecutionPolicy, class ForwardIt, class T>
 bit_iterator<ForwardIt> find(ExecutionPolicy&& policy, 
     bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last, const T& value) {
-    (policy, last, value);
-    return first;
+
+    // Types and constants
+    using difference_type = typename bit_iterator<ForwardIt>::difference_type;
+    constexpr difference_type slice = _min_chunk_size * CHAR_BIT;
+
+    // Initialization
+    const bit_value bv = value;
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, last, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    if (chunks == 1) {
+        return bit::find(first, last, bv);
+    }
+    std::atomic<std::size_t> best(chunks);
+    std::vector<bit_iterator<ForwardIt>> hits(chunks, last);
+
+    // Scans the chunks, publishing the lowest one with a match
+    _parallel_for(chunks, concurrency, [&](std::size_t i) {
+        bit_iterator<ForwardIt> cursor = bounds[i];
+        const bit_iterator<ForwardIt> chunk_last = bounds[i + 1];
+        difference_type remaining = bit::distance(cursor, chunk_last);
+        while (remaining && best.load(std::memory_order_relaxed) > i) {
+            const difference_type len = std::min(remaining, slice);
+            const bit_iterator<ForwardIt> slice_last = cursor + len;
+            const bit_iterator<ForwardIt> hit = bit::find(
+                cursor, slice_last, bv);
+            if (hit != slice_last) {
+                hits[i] = hit;
+                std::size_t current = best.load(std::memory_order_relaxed);
+                while (i < current && !best.compare_exchange_weak(current, i)) {
+                }
+                return;
+            }
+            cursor = slice_last;
+            remaining -= len;
+        }
+    });
+
+    // Finalization
+    const std::size_t found = best.load();
+    return found < chunks ? hits[found] : last;
 }
 
 // Status: on hold
@@ -21,22 +21,129 @@ namespace bit {
 
 
 
-// Status: to do
+// Status: complete
+// Candidate positions are tested one word at a time: bit i of the match mask
+// survives if the text starting at i agrees with the first word of the
+// pattern, longer patterns being verified candidate by candidate. Words are
+// scanned from the end when the iterators allow it, so the first match found
+// is the last occurrence
 template <class ForwardIt1, class ForwardIt2>
 constexpr bit_iterator<ForwardIt1> find_end(bit_iterator<ForwardIt1> first,
     bit_iterator<ForwardIt1> last, bit_iterator<ForwardIt2> s_first,
     bit_iterator<ForwardIt2> s_last) {
-    (last, s_first, s_last); 
-    return first;
+
+    // Assertions
+    _assert_range_viability(first, last);
+    _assert_range_viability(s_first, s_last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt1>::word_type;
+    using size_type = typename bit_iterator<ForwardIt1>::size_type;
+    using category = typename bit_iterator<ForwardIt1>::iterator_category;
+    constexpr size_type digits = binary_digits<word_type>::value;
+    constexpr word_type one = 1;
+    constexpr bool is_bidirectional = std::is_base_of<
+        std::bidirectional_iterator_tag, category>::value;
+
+    // Initialization
+    const size_type n = bit::distance(first, last);
+    const size_type m = bit::distance(s_first, s_last);
+    if (m == 0 || m > n) {
+        return last;
+    }
+    const size_type prefix_len = std::min(m, digits);
+    const word_type prefix = get_word<word_type>(s_first, prefix_len);
+    const size_type num_candidates = n - m + 1;
+    const size_type num_blocks = (num_candidates + digits - 1) / digits;
+
+    // Checks that the pattern bits past the first word match at position
+    auto matches_suffix = [&](bit_iterator<ForwardIt1> position) {
+        bit_iterator<ForwardIt1> it = position + digits;
+        bit_iterator<ForwardIt2> s_it = s_first + digits;
+        size_type remaining = m - digits;
+        while (remaining) {
+            const size_type len = std::min(remaining, digits);
+            word_type diff = get_word<word_type>(it, len) 
+                ^ get_word<word_type>(s_it, len);
+            if (len < digits) {
+                diff &= static_cast<word_type>((one << len) - 1);
+            }
+            if (diff) {
+                return false;
+            }
+            remaining -= len;
+            it = it + len;
+            s_it = s_it + len;
+        }
+        return true;
+    };
+
+    // Returns the highest matching candidate of the block starting at
+    // cursor, s bits after first, or digits if there is none
+    auto match_block = [&](bit_iterator<ForwardIt1> cursor, size_type s) {
+        const size_type candidates = std::min(digits, num_candidates - s);
+        const size_type available = n - s;
+        const word_type lo = get_word<word_type>(
+            cursor, std::min(available, digits));
+        const word_type hi = available > digits 
+            ? get_word<word_type>(cursor + digits, 
+                std::min(available - digits, digits))
+            : word_type();
+        word_type mask = candidates < digits 
+            ? static_cast<word_type>((one << candidates) - 1)
+            : static_cast<word_type>(-1);
+        for (size_type j = 0; j < prefix_len && mask; ++j) {
+            const word_type text = j == 0 ? lo : _shrd<word_type>(lo, hi, j);
+            mask &= (prefix >> j) & one 
+                ? text : static_cast<word_type>(~text);
+        }
+        while (mask) {
+            const size_type i = digits - 1 - _lzcnt(mask);
+            if (m <= digits || matches_suffix(cursor + i)) {
+                return i;
+            }
+            mask &= static_cast<word_type>(~(one << i));
+        }
+        return digits;
+    };
+
+    // Scans blocks of candidates backward and stops at the first match
+    if constexpr (is_bidirectional) {
+        size_type s = (num_blocks - 1) * digits;
+        bit_iterator<ForwardIt1> cursor = first + s;
+        for (size_type block = 0; block < num_blocks; ++block) {
+            const size_type i = match_block(cursor, s);
+            if (i != digits) {
+                return cursor + i;
+            }
+            if (s) {
+                cursor -= digits;
+                s -= digits;
+            }
+        }
+        return last;
+    // Scans blocks of candidates forward and keeps the last match
+    } else {
+        bit_iterator<ForwardIt1> cursor = first;
+        bit_iterator<ForwardIt1> result = last;
+        for (size_type s = 0; s < num_candidates; s += digits) {
+            const size_type i = match_block(cursor, s);
+            if (i != digits) {
+                result = cursor + i;
+            }
+            cursor = cursor + std::min(digits, num_candidates - s);
+        }
+        return result;
+    }
 }
 
-// Status: to do
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
 bit_iterator<ForwardIt1> find_end(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> s_first, bit_iterator<ForwardIt2> s_last) {
-    (policy, last, s_first, s_last); 
-    return first;
+    static_cast<void>(policy);
+    return bit::find_end(first, last, s_first, s_last);
 }
 
 // Status: on hold
@@ -18,22 +18,30 @@
 
 namespace bit {
 
-// Status: to do
+// Status: complete
+// A set of bits contains at most two distinct values: the search reduces to
+// finding whichever values appear in [s_first, s_last)
 template <class InputIt, class ForwardIt>
 constexpr bit_iterator<InputIt> find_first_of(bit_iterator<InputIt> first,
     bit_iterator<InputIt> last, bit_iterator<ForwardIt> s_first,
     bit_iterator<ForwardIt> s_last) {
-    (last, s_first, s_last); 
-    return first;
+    if (first == last || s_first == s_last) {
+        return last;
+    }
+    const bit_value value = *s_first;
+    if (bit::find(s_first, s_last, ~value) != s_last) {
+        return first;
+    }
+    return bit::find(first, last, value);
 }
 
-// Status: to do
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
 bit_iterator<ForwardIt1> find_first_of(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> s_first, bit_iterator<ForwardIt2> s_last) {
-    (policy, last, s_first, s_last); 
-    return first;
+    static_cast<void>(policy);
+    return bit::find_first_of(first, last, s_first, s_last);
 }
 
 // Status: on hold
@@ -21,21 +21,46 @@ namespace bit {
 
 
 
-// Status: will not implement? 
+// Status: complete
+// Bits are summed modulo 2: d_first receives the prefix parity of the range
 template <class InputIt, class OutputIt>
 bit_iterator<OutputIt> inclusive_scan(bit_iterator<InputIt> first,
     bit_iterator<InputIt> last, bit_iterator<OutputIt> d_first) {
-    (first, last);
-    return d_first;
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+
+    // Computes the parity of each word and carries it to the next one
+    word_type carry = 0;
+    return _transform_words(first, last, d_first,
+        [&carry](word_type word, std::size_t len) {
+            word = _prefix_xor(word, carry);
+            carry = word >> (len - 1);
+            return word;
+        }
+    );
 }
 
-// Status: will not implement? 
+// Status: complete
+// Non-bit outputs receive the number of set bits up to each position
+template <class InputIt, class OutputIt>
+OutputIt inclusive_scan(bit_iterator<InputIt> first,
+    bit_iterator<InputIt> last, OutputIt d_first) {
+    _assert_range_viability(first, last);
+    using difference_type = typename bit_iterator<InputIt>::difference_type;
+    return _prefix_popcount(first, last, d_first, difference_type(), true);
+}
+
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
 bit_iterator<ForwardIt2> inclusive_scan(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first, bit_iterator<ForwardIt1> last,
     bit_iterator<ForwardIt2> d_first) {
-    (policy, first, last);
-    return d_first;
+    static_cast<void>(policy);
+    return bit::inclusive_scan(first, last, d_first);
 }
 
 // Status: on hold
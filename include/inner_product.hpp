@@ -12,6 +12,7 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <numeric>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -21,21 +22,29 @@ namespace bit {
 
 
 
-// Status: will not implement? 
+// Status: complete
+// Products of bits are conjunctions: the result is init plus popcount(a & b)
 template <class InputIt1, class InputIt2, class T>
 T inner_product(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2, T init) {
-    (first1, last1, first2);
-    return init;
+    _assert_range_viability(first1, last1);
+    return init + _count_transform<std::bit_and<>>(first1, last1, first2);
 }
 
-// Status: on hold 
+// Status: complete
+// A sum of bitwise operations is computed as popcount(a op b) in one pass,
+// other operations are folded bit by bit
 template <class InputIt1, class InputIt2, class T, class BinaryOperation1,
     class BinaryOperation2> T inner_product(bit_iterator<InputIt1> first1,
     bit_iterator<InputIt1> last1, bit_iterator<InputIt2> first2, T init, 
     BinaryOperation1 op1, BinaryOperation2 op2) {
-    (first1, last1, first2, op1, op2);
-    return init;
+    _assert_range_viability(first1, last1);
+    if constexpr (_is_plus<BinaryOperation1>::value 
+                  && _bitwise_operation<BinaryOperation2>::value) {
+        return init + _count_transform<BinaryOperation2>(first1, last1, first2);
+    } else {
+        return std::inner_product(first1, last1, first2, init, op1, op2);
+    }
 }
 
 // ========================================================================== //
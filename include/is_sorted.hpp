@@ -36,7 +36,7 @@ constexpr bool is_sorted(bit_iterator<ForwardIt> first,
         std::size_t bits_to_read = std::min(static_cast<std::size_t>(last - cursor), 
             binary_digits<word_type>::value);
 
-        word_type cur = get_word(cursor, bits_to_read); 
+        word_type cur = get_word<word_type>(cursor, bits_to_read); 
 
         std::size_t leading_zero_ct = _tzcnt(cur);
 
@@ -22,57 +22,46 @@ namespace bit {
 
 
 // Status: complete
+// The first set bit of the range is searched in its head, body and tail, in
+// that order, the body skipping contiguous 64-bit words without any set bit
+// by blocks of vectors
 template <class ForwardIt>
 constexpr bit_iterator<ForwardIt> max_element(bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last) {
 
-    using word_type = typename bit_iterator<ForwardIt>::word_type;
-    constexpr std::size_t num_digits = binary_digits<word_type>::value;
+    using word_type = typename _segmented_range<ForwardIt>::word_type;
+    const _segmented_range<ForwardIt> range = _segment(first, last);
 
-    bit_iterator<ForwardIt> cursor = first;
-
-    // handle misaligned first word. for example ^00100^101
-    if (!_is_aligned_lsb(cursor)) {
-
-        // if 0 > 1 (version with comparators) we'll need to do this differently
-        // maybe use _padded_read?
-        word_type shifted_first_word = _shift_towards_lsb(*(cursor.base()), 
-            cursor.position());
-
-        if (shifted_first_word > 0) {
-            std::size_t first_set_bit_position = _tzcnt(shifted_first_word);
-            return cursor + first_set_bit_position;
-        } 
-
-        cursor = bit_iterator(std::next(cursor.base()));
+    // Head
+    if (range.head_mask) {
+        const word_type word = *range.head & range.head_mask;
+        if (word) {
+            return bit_iterator<ForwardIt>(range.head, _tzcnt(word));
+        }
     }
 
-    ForwardIt word_cursor = cursor.base();
-
-    while (word_cursor != last.base()) {
-        word_type cur_word = *word_cursor;
-        if (cur_word > 0) {
-            std::size_t cur_set_bit_position = _tzcnt(cur_word);
-            return bit_iterator(word_cursor, cur_set_bit_position);
-        } 
-        ++word_cursor;
+    // Body
+    ForwardIt word_cursor = range.body_first;
+    if constexpr (_is_kernel_iterator<ForwardIt>::value) {
+        if (word_cursor != range.body_last) {
+            std::advance(word_cursor, _find_dispatch(word_cursor, 
+                std::distance(word_cursor, range.body_last), bit1));
+        }
     }
-
-    cursor = bit_iterator(word_cursor);
-    if (cursor == last) {
-        return first;
+    for (; word_cursor != range.body_last; ++word_cursor) {
+        const word_type word = *word_cursor;
+        if (word) {
+            return bit_iterator<ForwardIt>(word_cursor, _tzcnt(word));
+        }
     }
 
-    // final, incomplete word
-    // if 0 > 1 (version with comparators) we'll need to do this differently
-    word_type shifted_last_word = _shift_towards_msb(*(cursor.base()),
-        num_digits - last.position()); 
-
-    if (shifted_last_word > 0) {
-        word_type last_set_bit_position = _tzcnt(shifted_last_word);
-        return cursor + (last_set_bit_position - (num_digits - last.position()));
-    } 
-
+    // Tail
+    if (range.tail_mask) {
+        const word_type word = *range.body_last & range.tail_mask;
+        if (word) {
+            return bit_iterator<ForwardIt>(range.body_last, _tzcnt(word));
+        }
+    }
     return first;
 }
 
@@ -13,6 +13,8 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <climits>
 #include <iostream>
 // Project sources
 #include "bit_algorithm_details.hpp"
@@ -21,14 +23,14 @@
 
 namespace bit {
 
-// TODO
+// Status: complete
 template <class InputIt1, class InputIt2>
 constexpr std::pair<bit_iterator<InputIt1>, bit_iterator<InputIt2>> mismatch(
     bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2
 ) {
-    (last1);
-    return std::make_pair(first1, first2);
+    return bit::mismatch(first1, last1, first2,
+        std::next(first2, bit::distance(first1, last1)));
 }
 
 /*
@@ -65,44 +67,65 @@ template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2,
 } 
 */
 
-// TODO
+// Status: complete
+// Equal blocks of byte-aligned contiguous words are skipped with memcmp, and
+// the first mismatch is then searched by words of the narrower word type
 template <class InputIt1, class InputIt2>
 std::pair<bit_iterator<InputIt1>, bit_iterator<InputIt2>> mismatch(
    bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
    bit_iterator<InputIt2> first2, bit_iterator<InputIt2> last2
 ) {
-    // we'll make reads of the smaller of the two word types. 
+    // Assertions
+    _assert_range_viability(first1, last1);
+    _assert_range_viability(first2, last2);
+
+    // Types and constants: reads are made with the narrower word type
     using word1_type = typename bit_iterator<InputIt1>::word_type;
     using word2_type = typename bit_iterator<InputIt2>::word_type;
-
     constexpr std::size_t num_digits1 = binary_digits<word1_type>::value;
     constexpr std::size_t num_digits2 = binary_digits<word2_type>::value;
-
     using word_type = typename std::conditional<
       num_digits1 < num_digits2, word1_type, word2_type>::type;
+    constexpr std::size_t digits = binary_digits<word_type>::value;
+
+    // Initialization
+    std::size_t n = std::min(bit::distance(first1, last1),
+        bit::distance(first2, last2));
+
+    // Equal blocks of byte-aligned contiguous words
+    if constexpr (_is_byte_stream_iterator<InputIt1>::value
+                  && _is_byte_stream_iterator<InputIt2>::value) {
+        if (first1.position() % CHAR_BIT == 0
+            && first2.position() % CHAR_BIT == 0 && n >= CHAR_BIT) {
+            const std::size_t bits = CHAR_BIT * _common_prefix_bytes(
+                _byte_address(first1), _byte_address(first2), n / CHAR_BIT);
+            std::advance(first1, bits);
+            std::advance(first2, bits);
+            n -= bits;
+        }
+    }
 
-    bit_iterator<InputIt1> in1 = first1;
-    bit_iterator<InputIt2> in2 = first2;
-
-    while (true) {
-        word_type w1 = get_word(in1, binary_digits<word_type>::value);  
-        word_type w2 = get_word(in2, binary_digits<word_type>::value);
-
-        if (w1 != w2) {
-            // the two words don't match. let's find the position of the mismatched bits
-            while (in1 != last1 && in2 != last2 && *in1 == *in2) {
-              ++in1;
-              ++in2;
-            }
+    // Words until the first mismatched bit
+    while (n != 0) {
+        const std::size_t len = std::min(n, digits);
+        word_type diff = get_word<word_type>(first1, len)
+            ^ get_word<word_type>(first2, len);
+        if (len < digits) {
+            diff &= static_cast<word_type>(
+                (static_cast<word_type>(1) << len) - 1);
+        }
+        if (diff != 0) {
+            const std::size_t pos = static_cast<std::size_t>(_tzcnt(diff));
+            std::advance(first1, pos);
+            std::advance(first2, pos);
             break;
-        } else {
-            // the words match. advance the iterators by one word
-            std::advance(in1, binary_digits<word_type>::value);
-            std::advance(in2, binary_digits<word_type>::value);
         }
+        std::advance(first1, len);
+        std::advance(first2, len);
+        n -= len;
     }
-    return std::make_pair(in1, in2);
-}  
+    return std::make_pair(first1, first2);
+}
 
 // TODO
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2>
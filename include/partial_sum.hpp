@@ -21,12 +21,37 @@ namespace bit {
 
 
 
-// Status: will not implement?
+// Status: complete
+// Bits are summed modulo 2: d_first receives the prefix parity of the range
 template <class InputIt, class OutputIt>
 bit_iterator<OutputIt> partial_sum(bit_iterator<InputIt> first,
     bit_iterator<InputIt> last, bit_iterator<OutputIt> d_first) {
-    (first, last);
-    return d_first;
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+
+    // Computes the parity of each word and carries it to the next one
+    word_type carry = 0;
+    return _transform_words(first, last, d_first,
+        [&carry](word_type word, std::size_t len) {
+            word = _prefix_xor(word, carry);
+            carry = word >> (len - 1);
+            return word;
+        }
+    );
+}
+
+// Status: complete
+// Non-bit outputs receive the number of set bits up to each position
+template <class InputIt, class OutputIt>
+OutputIt partial_sum(bit_iterator<InputIt> first, bit_iterator<InputIt> last,
+    OutputIt d_first) {
+    _assert_range_viability(first, last);
+    using difference_type = typename bit_iterator<InputIt>::difference_type;
+    return _prefix_popcount(first, last, d_first, difference_type(), true);
 }
 
 // Status: on hold
@@ -0,0 +1,283 @@
+// ================================== RANK ================================== //
+// Project: The Experimental Bit Algorithms Library
+// Name: rank.hpp
+// Description: Two-level directory answering rank queries on bit ranges
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _RANK_HPP_INCLUDED
+#define _RANK_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <utility>
+#include <vector>
+// Project sources
+// Third-party libraries
+// Miscellaneous
+
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ***************************** RANK DIRECTORY ***************************** */
+// Number of set bits before any position of a random access bit range. The
+// range is divided in superblocks of 512 bits, each one described by two
+// interleaved 64-bit entries: the number of set bits before the superblock,
+// and the cumulative counts of its first seven blocks of 64 bits, packed on
+// 9 bits each. A rank query reads both entries and counts less than a
+// block. A select query searches the superblocks, then the blocks, and
+// deposits a single bit at the set bits of a word
+template <class RandomAccessIt>
+class rank_directory
+{
+    // Types
+    public:
+    using iterator = bit_iterator<RandomAccessIt>;
+    using size_type = std::size_t;
+    using entry_type = std::uint64_t;
+
+    // Constants
+    public:
+    static constexpr size_type block_size = 64;
+    static constexpr size_type superblock_size = 512;
+    static constexpr size_type blocks = superblock_size / block_size;
+    static constexpr size_type field_size = 9;
+
+    // Lifecycle
+    public:
+    rank_directory() = default;
+    rank_directory(iterator first, iterator last);
+    template <class ExecutionPolicy>
+    rank_directory(ExecutionPolicy&& policy, iterator first, iterator last);
+
+    // Queries
+    public:
+    size_type rank(size_type pos) const;
+    size_type select(size_type k) const;
+    size_type size() const noexcept;
+    size_type count() const noexcept;
+
+    // Implementation details: build
+    private:
+    template <class ExecutionPolicy>
+    void _build(const ExecutionPolicy& policy);
+    size_type _fill(size_type first_superblock, size_type last_superblock,
+        size_type offset);
+
+    // Implementation details: data members
+    private:
+    iterator _first;
+    size_type _size = 0;
+    std::vector<entry_type> _entries = std::vector<entry_type>(2);
+};
+/* ************************************************************************** */
+
+
+
+// ----------------------- RANK DIRECTORY: LIFECYCLE ------------------------ //
+// Builds the directory of [first, last) sequentially
+template <class RandomAccessIt>
+rank_directory<RandomAccessIt>::rank_directory(iterator first, iterator last)
+: _first(first)
+, _size(bit::distance(first, last))
+{
+    _build(execution::seq);
+}
+
+// Builds the directory of [first, last) with the provided policy
+template <class RandomAccessIt>
+template <class ExecutionPolicy>
+rank_directory<RandomAccessIt>::rank_directory(ExecutionPolicy&& policy,
+    iterator first, iterator last)
+: _first(first)
+, _size(bit::distance(first, last))
+{
+    _build(policy);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------ RANK DIRECTORY: QUERIES ------------------------- //
+// Returns the number of set bits in [first, first + pos), pos <= size()
+template <class RandomAccessIt>
+typename rank_directory<RandomAccessIt>::size_type
+rank_directory<RandomAccessIt>::rank(size_type pos) const
+{
+    const size_type superblock = pos / superblock_size;
+    const size_type block = pos % superblock_size / block_size;
+    const size_type start = superblock * superblock_size + block * block_size;
+    const entry_type packed = _entries[2 * superblock + 1];
+    size_type result = _entries[2 * superblock];
+    if (block) {
+        result += (packed >> (field_size * (block - 1)))
+            & ((entry_type(1) << field_size) - 1);
+    }
+    if (pos != start) {
+        result += _popcnt(get_word<entry_type>(_first + start, pos - start)
+            & ((entry_type(1) << (pos - start)) - 1));
+    }
+    return result;
+}
+
+// Returns the position of the set bit of rank k, the one preceded by k set
+// bits, or size() if there are not more than k set bits
+template <class RandomAccessIt>
+typename rank_directory<RandomAccessIt>::size_type
+rank_directory<RandomAccessIt>::select(size_type k) const
+{
+    // Last superblock preceded by at most k set bits
+    if (k >= count()) {
+        return _size;
+    }
+    size_type low = 0;
+    size_type high = _entries.size() / 2;
+    while (high - low > 1) {
+        const size_type middle = low + (high - low) / 2;
+        if (_entries[2 * middle] <= k) {
+            low = middle;
+        } else {
+            high = middle;
+        }
+    }
+
+    // Last block of the superblock preceded by at most k set bits
+    const entry_type packed = _entries[2 * low + 1];
+    const entry_type field_mask = (entry_type(1) << field_size) - 1;
+    size_type r = k - _entries[2 * low];
+    size_type block = 0;
+    while (block + 1 < blocks
+        && ((packed >> (field_size * block)) & field_mask) <= r) {
+        ++block;
+    }
+    if (block) {
+        r -= (packed >> (field_size * (block - 1))) & field_mask;
+    }
+
+    // Set bit of rank r in the block
+    const size_type start = low * superblock_size + block * block_size;
+    const size_type len = std::min(block_size, _size - start);
+    entry_type word = get_word<entry_type>(_first + start, len);
+    if (len < block_size) {
+        word &= (entry_type(1) << len) - 1;
+    }
+    return start + _select_dispatch(word, static_cast<unsigned>(r));
+}
+
+// Returns the number of bits of the range
+template <class RandomAccessIt>
+typename rank_directory<RandomAccessIt>::size_type
+rank_directory<RandomAccessIt>::size() const noexcept
+{
+    return _size;
+}
+
+// Returns the number of set bits of the range
+template <class RandomAccessIt>
+typename rank_directory<RandomAccessIt>::size_type
+rank_directory<RandomAccessIt>::count() const noexcept
+{
+    return rank(_size);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------- RANK DIRECTORY: IMPLEMENTATION DETAILS --------------- //
+// Counts the chunks of superblocks in parallel, scans the chunk totals, and
+// fills the entries of every chunk from its offset in parallel. A single
+// thread fills all the entries in one pass, without counting first
+template <class RandomAccessIt>
+template <class ExecutionPolicy>
+void rank_directory<RandomAccessIt>::_build(const ExecutionPolicy& policy)
+{
+    // Initialization
+    const size_type superblocks = _size / superblock_size + 1;
+    const size_type concurrency = _concurrency(policy);
+    const size_type min_superblocks = std::max<size_type>(
+        _min_chunk_size * CHAR_BIT / superblock_size, 1);
+    const size_type chunks = concurrency == 1 ? 1 : std::max<size_type>(
+        std::min(concurrency * _chunks_per_thread, 
+            superblocks / min_superblocks), 1);
+    const size_type chunk_superblocks = (superblocks + chunks - 1) / chunks;
+    std::vector<size_type> offsets(chunks + 1, 0);
+    _entries.assign(2 * superblocks, 0);
+
+    // Counts the set bits of every chunk
+    auto chunk_bounds = [&](size_type i) {
+        const size_type first_superblock = std::min(
+            i * chunk_superblocks, superblocks);
+        const size_type last_superblock = std::min(
+            first_superblock + chunk_superblocks, superblocks);
+        return std::make_pair(first_superblock, last_superblock);
+    };
+    if (chunks > 1) {
+        _parallel_for(chunks - 1, concurrency, [&](size_type i) {
+            const auto bounds = chunk_bounds(i);
+            const size_type first = bounds.first * superblock_size;
+            const size_type last = std::min(
+                bounds.second * superblock_size, _size);
+            offsets[i + 1] = static_cast<size_type>(bit::count(
+                _first + first, _first + last, bit1));
+        });
+        for (size_type i = 0; i < chunks; ++i) {
+            offsets[i + 1] += offsets[i];
+        }
+    }
+
+    // Fills the entries of every chunk
+    _parallel_for(chunks, concurrency, [&](size_type i) {
+        const auto bounds = chunk_bounds(i);
+        _fill(bounds.first, bounds.second, offsets[i]);
+    });
+}
+
+// Fills the entries of [first_superblock, last_superblock), offset being the
+// number of set bits before the first one, and returns the number after
+template <class RandomAccessIt>
+typename rank_directory<RandomAccessIt>::size_type
+rank_directory<RandomAccessIt>::_fill(size_type first_superblock,
+    size_type last_superblock, size_type offset)
+{
+    for (size_type s = first_superblock; s < last_superblock; ++s) {
+        entry_type packed = 0;
+        size_type relative = 0;
+        for (size_type b = 0; b < blocks; ++b) {
+            const size_type start = s * superblock_size + b * block_size;
+            if (b) {
+                packed |= static_cast<entry_type>(relative)
+                    << (field_size * (b - 1));
+            }
+            if (start < _size) {
+                const size_type len = std::min(block_size, _size - start);
+                entry_type word = get_word<entry_type>(_first + start, len);
+                if (len < block_size) {
+                    word &= (entry_type(1) << len) - 1;
+                }
+                relative += _popcnt(word);
+            }
+        }
+        _entries[2 * s] = offset;
+        _entries[2 * s + 1] = packed;
+        offset += relative;
+    }
+    return offset;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+
+#endif // _RANK_HPP_INCLUDED
+// ========================================================================== //
@@ -12,6 +12,7 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <numeric>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -21,51 +22,57 @@ namespace bit {
 
 
 
-// Status: will not implement?
+// Status: complete
+// Bits are summed as integers: the result is the number of set bits
 template <class InputIt>
-typename bit_iterator<InputIt>::value_type reduce(bit_iterator<InputIt> first,
-    bit_iterator<InputIt> last) {
-    (first, last);
-    return 0;
+typename bit_iterator<InputIt>::difference_type reduce(
+    bit_iterator<InputIt> first, bit_iterator<InputIt> last) {
+    return bit::count(first, last, bit1);
 }
 
-// Status: will not implement?
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt>
-typename bit_iterator<ForwardIt>::value_type reduce(ExecutionPolicy&& policy,
-    bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last) {
-    (policy, first, last);
-    return 0;
+typename bit_iterator<ForwardIt>::difference_type reduce(
+    ExecutionPolicy&& policy, bit_iterator<ForwardIt> first,
+    bit_iterator<ForwardIt> last) {
+    return bit::count(policy, first, last, bit1);
 }
 
-// Status: will not implement?
+// Status: complete
 template <class InputIt, class T>
 T reduce(bit_iterator<InputIt> first, bit_iterator<InputIt> last, T init) {
-    (first, last, init);
-    return init;
+    return init + bit::count(first, last, bit1);
 }
 
-// Status: will not implement?
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt, class T>
 T reduce(ExecutionPolicy&& policy, bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last, T init) {
-    (policy, first, last);
-    return init;
+    return init + bit::reduce(policy, first, last);
 }
 
-// Status: on hold
+// Status: complete
+// Sums are computed as popcounts, other operations are folded bit by bit
 template <class InputIt, class T, class BinaryOp>
 T reduce(bit_iterator<InputIt> first, bit_iterator<InputIt> last, T init,
     BinaryOp binary_op) {
-    (first, last, binary_op);
-    return init;
+    if constexpr (_is_plus<BinaryOp>::value) {
+        return init + bit::count(first, last, bit1);
+    } else {
+        return std::accumulate(first, last, init, binary_op);
+    }
 }
 
-// Status: on hold
+// Status: complete
 template <class ExecutionPolicy, class ForwardIt, class T, class BinaryOp>
 T reduce(ExecutionPolicy&& policy, bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last, T init, BinaryOp binary_op) {
-    (policy, first, last, binary_op);
-    return init;
+    if constexpr (_is_plus<BinaryOp>::value) {
+        return init + bit::reduce(policy, first, last);
+    } else {
+        static_cast<void>(policy);
+        return bit::reduce(first, last, init, binary_op);
+    }
 }
 
 // ========================================================================== //
@@ -15,6 +15,10 @@
 
 // ================================ PREAMBLE ================================ //
 // C++ standard library
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
 // Project sources
 #include "bit.hpp"
 // Third-party libraries
@@ -24,6 +28,81 @@ namespace bit {
 
 
 
+// ---------------------------- Reverse Details ----------------------------- //
+// Reverses the bits [position, position + n) of the words starting at base in
+// a single pass. Word w of the result is the bitswapped funnel shift of the
+// input words q - w and q - w + 1, for a q and a shift depending only on the
+// bounds. Words are processed from both ends towards the middle, so that
+// every input word is still unmodified when read, except one which is
+// carried. Contiguous 64-bit words go through the vectorized kernel first
+template <class RandomAccessIt>
+void _reverse_words(RandomAccessIt base,
+    typename std::iterator_traits<RandomAccessIt>::difference_type position,
+    typename std::iterator_traits<RandomAccessIt>::difference_type n)
+{
+    // Types and constants
+    using word_type = typename std::iterator_traits<RandomAccessIt>::value_type;
+    using difference_type = 
+        typename std::iterator_traits<RandomAccessIt>::difference_type;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type words = (position + n + digits - 1) / digits;
+    const difference_type end = (position + n) % digits;
+    const difference_type total = 2 * position + n - digits;
+    const difference_type q = total >= 0 ? total / digits : -1;
+    const difference_type shift = total - q * digits;
+    const word_type first_word = base[0];
+    const word_type last_word = base[words - 1];
+    auto funnel = [shift](word_type low, word_type high) {
+        return shift 
+            ? static_cast<word_type>((low >> shift) 
+                                   | (high << (digits - shift)))
+            : low;
+    };
+
+    // The last word, whose low input word is before the range
+    difference_type left = 0;
+    difference_type right = q + 1;
+    word_type carry = right < words ? base[right] : word_type(0);
+    if (right < words) {
+        base[right] = _bitswap<word_type>(funnel(word_type(0), base[0]));
+    }
+
+    // Words from both ends, vectorized first
+    if constexpr (_is_contiguous_iterator<RandomAccessIt>::value
+                  && sizeof(word_type) == sizeof(_word64)) {
+        _word64 wide_carry = carry;
+        _kernels().reverse(reinterpret_cast<_word64*>(std::addressof(*base)),
+            left, right, wide_carry, static_cast<unsigned>(shift));
+        carry = static_cast<word_type>(wide_carry);
+    }
+    for (; left < right - 1; ++left, --right) {
+        const word_type word = base[right - 1];
+        const word_type low = base[left];
+        const word_type high = base[left + 1];
+        base[left] = _bitswap<word_type>(funnel(word, carry));
+        base[right - 1] = _bitswap<word_type>(funnel(low, high));
+        carry = word;
+    }
+    if (left == right - 1) {
+        base[left] = _bitswap<word_type>(funnel(base[left], carry));
+    }
+
+    // Restores the bits around the range
+    if (position != 0) {
+        base[0] = _bitblend<word_type>(first_word, base[0], position, 
+            digits - position);
+    }
+    if (end != 0) {
+        base[words - 1] = _bitblend<word_type>(base[words - 1], last_word, 
+            end, digits - end);
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
 // --------------------------- Reverse Algorithms --------------------------- //
 // Status: complete
 template <class BidirIt>
@@ -48,6 +127,17 @@ constexpr void reverse(
     word_type first_value = {};
     word_type last_value = {};
 
+    // Reverse in a single pass when words can be accessed in any order
+    using category = typename bit_iterator<BidirIt>::iterator_category;
+    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                  category>::value) {
+        if (first.base() != last.base()) {
+            _reverse_words(first.base(), first.position(), 
+                bit::distance(first, last));
+            return;
+        }
+    }
+
     // Reverse when bit iterators are aligned
     if (is_first_aligned && is_last_aligned) {
         std::reverse(first.base(), last.base());
@@ -113,11 +203,112 @@ constexpr void reverse(
     }
 }
 
-// Status: to do
+// Status: complete
+// The first half is split into chunks, each paired with its mirror in the
+// second half: a worker swaps the two mirrored chunks one word at a time,
+// bitswapping the pieces. Words entirely inside the chunks of a worker are
+// written in place, while partial words, that neighbouring workers may
+// share, are collected and blended once all the workers are done
 template <class ExecutionPolicy, class BidirIt>
 void reverse(ExecutionPolicy&& policy, bit_iterator<BidirIt> first,
     bit_iterator<BidirIt> last) {
-    (policy, first, last);
+
+    // Assertions
+    _assert_range_viability(first, last);
+
+    // Types and constants
+    using word_type = typename bit_iterator<BidirIt>::word_type;
+    using difference_type = typename bit_iterator<BidirIt>::difference_type;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+    constexpr word_type ones = static_cast<word_type>(-1);
+
+    // Deferred write of the bits of mask
+    struct edge {
+        BidirIt it;
+        word_type value;
+        word_type mask;
+    };
+
+    // Initialization
+    const difference_type n = bit::distance(first, last);
+    const difference_type position = first.position();
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, first + n / 2, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    if (chunks == 1) {
+        return bit::reverse(first, last);
+    }
+    std::vector<std::vector<edge>> edges(chunks);
+
+    // Swaps [a, b) with its mirror [n - b, n - a), bits being offsets
+    _parallel_for(chunks, concurrency, [&](std::size_t i) {
+        const difference_type a = bit::distance(first, bounds[i]);
+        const difference_type b = bit::distance(first, bounds[i + 1]);
+
+        // Checks whether the j-th word is inside one of the two chunks
+        auto owns = [&](difference_type j) {
+            const difference_type lo = j * digits - position;
+            const difference_type hi = lo + digits;
+            return (lo >= a && hi <= b) || (lo >= n - b && hi <= n - a);
+        };
+
+        // Writes bits of mask in the j-th word, or defers it
+        auto store = [&](difference_type j, word_type value, word_type mask) {
+            const BidirIt it = std::next(first.base(), j);
+            if (owns(j)) {
+                *it = _bitblend<word_type>(*it, value, mask);
+                return;
+            }
+            for (edge& e: edges[i]) {
+                if (e.it == it) {
+                    e.value = _bitblend<word_type>(e.value, value, mask);
+                    e.mask |= mask;
+                    return;
+                }
+            }
+            edges[i].push_back(edge{it, value, mask});
+        };
+
+        // Writes the len low bits of value at offset
+        auto write = [&](difference_type offset, word_type value, 
+                         difference_type len) {
+            const difference_type j = (offset + position) / digits;
+            const difference_type shift = (offset + position) % digits;
+            const difference_type head = std::min(len, digits - shift);
+            const word_type mask = head < digits 
+                ? static_cast<word_type>((word_type(1) << head) - 1) 
+                : ones;
+            store(j, static_cast<word_type>(value << shift), 
+                  static_cast<word_type>(mask << shift));
+            if (head < len) {
+                store(j + 1, static_cast<word_type>(value >> head),
+                      static_cast<word_type>(
+                          (word_type(1) << (len - head)) - 1));
+            }
+        };
+
+        // Swaps and bitswaps the pieces of the two chunks
+        for (difference_type k = 0; k < b - a; k += digits) {
+            const difference_type len = std::min(digits, b - a - k);
+            const difference_type left = a + k;
+            const difference_type right = n - left - len;
+            const word_type left_word = get_word<word_type>(
+                first + left, len);
+            const word_type right_word = get_word<word_type>(
+                first + right, len);
+            write(left, static_cast<word_type>(
+                _bitswap<word_type>(right_word) >> (digits - len)), len);
+            write(right, static_cast<word_type>(
+                _bitswap<word_type>(left_word) >> (digits - len)), len);
+        }
+    });
+
+    // Blends the partial words, whose masks are disjoint across workers
+    for (const std::vector<edge>& chunk_edges: edges) {
+        for (const edge& e: chunk_edges) {
+            *e.it = _bitblend<word_type>(*e.it, e.value, e.mask);
+        }
+    }
 }
 
 
@@ -14,6 +14,7 @@
 
 // ================================ PREAMBLE ================================ //
 // C++ standard library
+#include <vector>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -23,6 +24,11 @@ namespace bit {
 
 
 // --------------------------- Shift Algorithms ----------------------------- //
+// Status: complete
+// Single pass from the end: every destination word is a funnel shift of two
+// source words, the lower one being kept for the next word, so that each
+// source word is read once. Contiguous 64-bit words are funnel shifted by
+// the vector kernels. Forward iterators rotate the words instead
 template <class ForwardIt>
 bit_iterator<ForwardIt> shift_right(bit_iterator<ForwardIt> first,
                                    bit_iterator<ForwardIt> last,
@@ -36,6 +42,7 @@ bit_iterator<ForwardIt> shift_right(bit_iterator<ForwardIt> first,
     // Types and constants
     using word_type = typename bit_iterator<ForwardIt>::word_type;
     using size_type = typename bit_iterator<ForwardIt>::size_type;
+    using category = typename bit_iterator<ForwardIt>::iterator_category;
     constexpr size_type digits = binary_digits<word_type>::value;
 
     // Initialization
@@ -45,58 +52,115 @@ bit_iterator<ForwardIt> shift_right(bit_iterator<ForwardIt> first,
     const bool is_last_aligned = last.position() == 0;
     auto d = distance(first, last);
     if (n <= 0 || n >= d) return first;
-    word_type first_value = *first.base();
-    word_type last_value = !is_last_aligned ? *last.base() : 0;
-    word_type mask = is_first_aligned ? 
-        static_cast<word_type>(-1)
-        : 
-        static_cast<word_type>(
-                (static_cast<word_type>(1) << (digits - first.position())) - 1
-        ) << first.position();
-    *first.base() = *first.base() & mask;
-    ForwardIt it = word_shift_right(first.base(), 
-                               std::next(last.base(), 
-                                         !is_last_aligned
-                                         ),
-                               word_shifts
-    );
-    bit_iterator<ForwardIt> d_first(it, first.position());
-    // Shift bit sequence to the msb 
-    if (remaining_bitshifts) {
-        word_type temp_1 = *it;
-        word_type temp_2;
-        *it = *it << remaining_bitshifts;
-        it++;
-        //TODO probably a way to do this with 1 temp or
-        // at least no value swapping
-        for (; it != std::next(last.base(), !is_last_aligned); ++it) {
-            temp_2 = *it;
-            *it = _shld<word_type>(*it, temp_1, remaining_bitshifts);
-            temp_1 = temp_2; 
+
+    // Fused word and bit shift, from the last word to the first
+    if constexpr (std::is_base_of<std::bidirectional_iterator_tag, 
+                                  category>::value) {
+        size_type remaining = d - n;
+        bit_iterator<ForwardIt> src_last = last - n;
+        ForwardIt it = last.base();
+
+        // Partial last word
+        if (!is_last_aligned) {
+            const size_type len = std::min<size_type>(remaining, 
+                last.position());
+            const size_type start = last.position() - len;
+            src_last = src_last - len;
+            *it = _bitblend<word_type>(*it, static_cast<word_type>(
+                get_word<word_type>(src_last, len) << start), start, len);
+            remaining -= len;
         }
-    }
-    // Blend bits of the first element
-    if (!is_first_aligned) {
-        *first.base() = _bitblend<word_type>(
-                first_value,
-                *first.base(),
-                first.position(),
-                digits - first.position()
-        );
-    }
-    // Blend bits of the last element
-    if (!is_last_aligned) {
-        *last.base() = _bitblend<word_type>(
-                *last.base(),
-                last_value,
-                last.position(),
-                digits - last.position()
+
+        // Full words
+        if (remaining >= digits) {
+            const size_type shift = src_last.position();
+            ForwardIt src_it = src_last.base();
+            if constexpr (_is_kernel_iterator<ForwardIt>::value) {
+                const size_type words = remaining / digits;
+                it -= words;
+                src_it -= words;
+                _funnel_dispatch(it, src_it, words, shift);
+                remaining -= words * digits;
+            } else {
+                word_type high = shift ? *src_it : word_type();
+                word_type low = {};
+                for (; remaining >= digits; remaining -= digits) {
+                    low = *--src_it;
+                    *--it = shift ? _shrd<word_type>(low, high, shift) : low;
+                    high = low;
+                }
+            }
+            src_last = bit_iterator<ForwardIt>(src_it, shift);
+        }
+
+        // Partial first word of the destination
+        if (remaining) {
+            --it;
+            *it = _bitblend<word_type>(*it, static_cast<word_type>(
+                get_word<word_type>(first, remaining) << (digits - remaining)),
+                digits - remaining, remaining);
+        }
+        bit::fill(first, first + n, bit0);
+        return first + n;
+
+    // Rotation of the words followed by a bit shift
+    } else {
+        word_type first_value = *first.base();
+        word_type last_value = !is_last_aligned ? *last.base() : 0;
+        word_type mask = is_first_aligned ? 
+            static_cast<word_type>(-1)
+            : 
+            static_cast<word_type>(
+                    (static_cast<word_type>(1) << (digits - first.position())) - 1
+            ) << first.position();
+        *first.base() = *first.base() & mask;
+        ForwardIt it = word_shift_right(first.base(), 
+                                   std::next(last.base(), 
+                                             !is_last_aligned
+                                             ),
+                                   word_shifts
         );
+        // Shift bit sequence to the msb 
+        if (remaining_bitshifts) {
+            word_type temp_1 = *it;
+            word_type temp_2;
+            *it = *it << remaining_bitshifts;
+            it++;
+            //TODO probably a way to do this with 1 temp or
+            // at least no value swapping
+            for (; it != std::next(last.base(), !is_last_aligned); ++it) {
+                temp_2 = *it;
+                *it = _shld<word_type>(*it, temp_1, remaining_bitshifts);
+                temp_1 = temp_2; 
+            }
+        }
+        // Blend bits of the first element
+        if (!is_first_aligned) {
+            *first.base() = _bitblend<word_type>(
+                    first_value,
+                    *first.base(),
+                    first.position(),
+                    digits - first.position()
+            );
+        }
+        // Blend bits of the last element
+        if (!is_last_aligned) {
+            *last.base() = _bitblend<word_type>(
+                    *last.base(),
+                    last_value,
+                    last.position(),
+                    digits - last.position()
+            );
+        }
+        return std::next(first, n);
     }
-    std::advance(first, remaining_bitshifts);
-    return first;
 }
 
+// Status: complete
+// Single pass from the start: every destination word is a funnel shift of
+// two source words, the upper one being kept for the next word, so that each
+// source word is read once. Contiguous 64-bit words are funnel shifted by
+// the vector kernels
 template <class ForwardIt>
 bit_iterator<ForwardIt> shift_left(bit_iterator<ForwardIt> first,
                                    bit_iterator<ForwardIt> last,
@@ -112,71 +176,197 @@ bit_iterator<ForwardIt> shift_left(bit_iterator<ForwardIt> first,
     constexpr size_type digits = binary_digits<word_type>::value;
 
     // Initialization
-    size_type word_shifts = n / digits; 
-    size_type remaining_bitshifts = n - digits*(word_shifts);
-    const bool is_first_aligned = first.position() == 0;
-    const bool is_last_aligned = last.position() == 0;
     auto d = distance(first, last);
     if (n <= 0 || n >= d) return first;
-    word_type first_value = *first.base();
-    word_type last_value = !is_last_aligned ? *last.base() : 0;
-
-    // Shift words to the left using std::shift 
-    ForwardIt new_last_base = word_shift_left(first.base(), 
-                                         last.base(), 
-                                         word_shifts
-    );
-    // Mask out-of-range bits so that we don't incorporate them
-    if (!is_last_aligned) {
-        *new_last_base &= (static_cast<word_type>(1) << last.position()) - 1; 
+    size_type remaining = d - n;
+    bit_iterator<ForwardIt> src_first = first + n;
+    ForwardIt it = first.base();
+
+    // Partial first word
+    if (first.position() != 0) {
+        const size_type len = std::min<size_type>(remaining, 
+            digits - first.position());
+        *it = _bitblend<word_type>(*it, static_cast<word_type>(
+            get_word<word_type>(src_first, len) << first.position()), 
+            first.position(), len);
+        src_first = src_first + len;
+        remaining -= len;
+        ++it;
+    }
+
+    // Full words
+    if (remaining >= digits) {
+        const size_type shift = src_first.position();
+        ForwardIt src_it = src_first.base();
+        if constexpr (_is_kernel_iterator<ForwardIt>::value) {
+            const size_type words = remaining / digits;
+            _funnel_dispatch(it, src_it, words, shift);
+            remaining -= words * digits;
+            it += words;
+            src_it += words;
+        } else if (shift) {
+            word_type low = *src_it;
+            word_type high = {};
+            for (; remaining >= digits; remaining -= digits) {
+                high = *++src_it;
+                *it++ = _shrd<word_type>(low, high, shift);
+                low = high;
+            }
+        } else {
+            for (; remaining >= digits; remaining -= digits) {
+                *it++ = *src_it++;
+            }
+        }
+        src_first = bit_iterator<ForwardIt>(src_it, shift);
+    }
+
+    // Partial last word of the destination
+    if (remaining) {
+        *it = _bitblend<word_type>(*it, 
+            get_word<word_type>(src_first, remaining), 0, remaining);
     }
-    bit_iterator<ForwardIt> d_last(new_last_base, last.position());
-    // Shift bit sequence to the lsb 
-    if (remaining_bitshifts) {
-        ForwardIt it = first.base();
-        // Desired last iterator may be one before the current last 
-        // so we need to keep track of the penultimate iterator.
-        ForwardIt latent_it = it;
-        // _shrd all words except the last
-        for (; std::next(it, is_last_aligned) != new_last_base; ++it) {
-            *it = _shrd<word_type>(*it, *std::next(it), remaining_bitshifts);
-            latent_it = it;
+    bit::fill(first + (d - n), last, bit0);
+    return first + (d - n);
+}
+
+// Status: complete
+// Chunks of the range are shifted in parallel, each one first saving the n
+// bits of its neighbour that it needs, so that no chunk overwrites bits that
+// another one has yet to read. The last chunk may be shorter than n, in which
+// case it is only cleared. Shifts longer than another chunk are carried out
+// as a sequence of parallel copies of n bits, whose sources and destinations
+// do not overlap
+template <class ExecutionPolicy, class ForwardIt>
+bit_iterator<ForwardIt> shift_left(ExecutionPolicy&& policy,
+    bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last,
+    typename bit_iterator<ForwardIt>::difference_type n) {
+
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    using difference_type = typename bit_iterator<ForwardIt>::difference_type;
+    using buffer_type = std::vector<word_type>;
+    using buffer_iterator = bit_iterator<typename buffer_type::iterator>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    _assert_range_viability(first, last);
+    const difference_type d = bit::distance(first, last);
+    if (n <= 0 || n >= d) return first;
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, last, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    std::vector<difference_type> lengths(chunks);
+    difference_type shortest = d;
+    for (std::size_t i = 0; i < chunks; ++i) {
+        lengths[i] = bit::distance(bounds[i], bounds[i + 1]);
+        if (i + 1 < chunks) {
+            shortest = std::min(shortest, lengths[i]);
         }
-        // For the last word simpy right shift
-        *it >>= remaining_bitshifts;
-
-        if (is_last_aligned) {
-            d_last = bit_iterator<ForwardIt>(it, digits-remaining_bitshifts);
-        } else { // Otherwise, last word may be the word before new_last_word
-            if (remaining_bitshifts > last.position()) 
-            {
-                d_last = bit_iterator<ForwardIt>(latent_it, 
-                            digits-(remaining_bitshifts - last.position())); 
+    }
+
+    // Saves the first n bits of every chunk but the first, then shifts the
+    // chunks and completes each one with the bits saved from the next, the
+    // bits missing from a short last chunk being zeros
+    if (chunks == 1) {
+        return bit::shift_left(first, last, n);
+    } else if (n < shortest) {
+        std::vector<buffer_type> saved(chunks, buffer_type(
+            (n + digits - 1) / digits));
+        _parallel_for(chunks - 1, concurrency, [&](std::size_t i) {
+            bit::copy(bounds[i + 1], 
+                bounds[i + 1] + std::min(n, lengths[i + 1]), 
+                buffer_iterator(saved[i].begin()));
+        });
+        _parallel_for(chunks, concurrency, [&](std::size_t i) {
+            if (n < lengths[i]) {
+                bit::shift_left(bounds[i], bounds[i + 1], n);
             } else {
-                d_last = bit_iterator<ForwardIt>(it, 
-                            last.position() - remaining_bitshifts);
+                bit::fill(bounds[i], bounds[i + 1], bit0);
+            }
+            if (i + 1 < chunks) {
+                const buffer_iterator saved_first(saved[i].begin());
+                bit::copy(saved_first, saved_first + n, bounds[i + 1] - n);
             }
+        });
+
+    // Moves stripes of n bits from the first to the last
+    } else {
+        for (difference_type k = 0; k < d - n; k += n) {
+            const difference_type len = std::min(n, d - n - k);
+            bit::copy(policy, first + (k + n), first + (k + n + len), 
+                first + k);
         }
+        bit::fill(policy, first + (d - n), last, bit0);
     }
-    // Blend bits of the first element
-    if (!is_first_aligned) {
-        *first.base() = _bitblend<word_type>(
-                first_value,
-                *first.base(),
-                first.position(),
-                digits - first.position()
-        );
+    return first + (d - n);
+}
+
+// Status: complete
+// Mirror of shift_left: each chunk saves the last n bits of its predecessor
+// before shifting, the last chunk only getting the first bits it can hold,
+// and long shifts move stripes from the last to the first
+template <class ExecutionPolicy, class ForwardIt>
+bit_iterator<ForwardIt> shift_right(ExecutionPolicy&& policy,
+    bit_iterator<ForwardIt> first, bit_iterator<ForwardIt> last,
+    typename bit_iterator<ForwardIt>::difference_type n) {
+
+    // Types and constants
+    using word_type = typename bit_iterator<ForwardIt>::word_type;
+    using difference_type = typename bit_iterator<ForwardIt>::difference_type;
+    using buffer_type = std::vector<word_type>;
+    using buffer_iterator = bit_iterator<typename buffer_type::iterator>;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    _assert_range_viability(first, last);
+    const difference_type d = bit::distance(first, last);
+    if (n <= 0 || n >= d) return first;
+    const std::size_t concurrency = _concurrency(policy);
+    const auto bounds = _partition(first, last, concurrency);
+    const std::size_t chunks = bounds.size() - 1;
+    std::vector<difference_type> lengths(chunks);
+    difference_type shortest = d;
+    for (std::size_t i = 0; i < chunks; ++i) {
+        lengths[i] = bit::distance(bounds[i], bounds[i + 1]);
+        if (i + 1 < chunks) {
+            shortest = std::min(shortest, lengths[i]);
+        }
     }
-    // Blend bits of the last element
-    if (!is_last_aligned) {
-        *last.base() = _bitblend<word_type>(
-                *last.base(),
-                last_value,
-                last.position(),
-                digits - last.position()
-        );
+
+    // Saves the last n bits of every chunk but the last, then shifts the
+    // chunks and completes each one with the bits saved from the previous,
+    // as many as it holds
+    if (chunks == 1) {
+        return bit::shift_right(first, last, n);
+    } else if (n < shortest) {
+        std::vector<buffer_type> saved(chunks, buffer_type(
+            (n + digits - 1) / digits));
+        _parallel_for(chunks - 1, concurrency, [&](std::size_t i) {
+            bit::copy(bounds[i + 1] - n, 
+                bounds[i + 1] - n + std::min(n, lengths[i + 1]), 
+                buffer_iterator(saved[i].begin()));
+        });
+        _parallel_for(chunks, concurrency, [&](std::size_t i) {
+            if (n < lengths[i]) {
+                bit::shift_right(bounds[i], bounds[i + 1], n);
+            }
+            if (i > 0) {
+                const buffer_iterator saved_first(saved[i - 1].begin());
+                bit::copy(saved_first, 
+                    saved_first + std::min(n, lengths[i]), bounds[i]);
+            }
+        });
+
+    // Moves stripes of n bits from the last to the first
+    } else {
+        for (difference_type k = d - n; k > 0; k -= n) {
+            const difference_type len = std::min(n, k);
+            bit::copy(policy, first + (k - len), first + k, 
+                first + (k - len + n));
+        }
+        bit::fill(policy, first, first + n, bit0);
     }
-    return d_last;
+    return first + n;
 }
 // -------------------------------------------------------------------------- //
 
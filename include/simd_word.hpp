@@ -0,0 +1,526 @@
+// =============================== SIMD WORD ================================ //
+// Project: The Experimental Bit Algorithms Library
+// Name: simd_word.hpp
+// Description: Wide unsigned words of 128 to 512 bits for bit iterators
+// Creator: Vincent Reverdy
+// Contributor(s):
+// License: BSD 3-Clause License
+// ========================================================================== //
+#ifndef _SIMD_WORD_HPP_INCLUDED
+#define _SIMD_WORD_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// ============================== PREAMBLE ================================== //
+// C++ standard library
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+// Project sources
+#include "bit_algorithm_details.hpp"
+// Third-party libraries
+// Miscellaneous
+
+namespace bit {
+// ========================================================================== //
+
+
+
+/* ******************************* SIMD WORD ******************************** */
+// Unsigned integer of Bits bits, made of 64-bit limbs stored from the least
+// significant one and aligned on the size of the word, so that the loops on
+// the limbs of bitwise operations compile to single vector instructions.
+// Shifts move whole limbs and funnel the remaining bits, arithmetic
+// operations propagate carries across limbs. It converts implicitly from
+// integers, with the semantics of unsigned integers, and explicitly to
+// integers and bool, so that it can be the word type of bit iterators
+template <std::size_t Bits>
+class alignas(Bits / CHAR_BIT) simd_word
+{
+    // Assertions
+    static_assert(Bits >= 128 && (Bits & (Bits - 1)) == 0, "");
+
+    // Types
+    public:
+    using limb_type = std::uint64_t;
+
+    // Constants
+    public:
+    static constexpr std::size_t limb_digits = 64;
+    static constexpr std::size_t limbs = Bits / limb_digits;
+
+    // Lifecycle
+    public:
+    constexpr simd_word() noexcept;
+    template <class T, class = std::enable_if_t<std::is_integral<T>::value>>
+    constexpr simd_word(T value) noexcept;
+
+    // Conversion
+    public:
+    constexpr explicit operator bool() const noexcept;
+    template <class T, class = std::enable_if_t<std::is_integral<T>::value>>
+    constexpr explicit operator T() const noexcept;
+
+    // Access
+    public:
+    constexpr limb_type& limb(std::size_t i) noexcept;
+    constexpr limb_type limb(std::size_t i) const noexcept;
+
+    // Bitwise operators
+    public:
+    friend constexpr simd_word operator~(simd_word x) noexcept {
+        for (std::size_t i = 0; i < limbs; ++i) {
+            x._limbs[i] = ~x._limbs[i];
+        }
+        return x;
+    }
+    friend constexpr simd_word operator&(simd_word x, simd_word y) noexcept {
+        return x &= y;
+    }
+    friend constexpr simd_word operator|(simd_word x, simd_word y) noexcept {
+        return x |= y;
+    }
+    friend constexpr simd_word operator^(simd_word x, simd_word y) noexcept {
+        return x ^= y;
+    }
+    friend constexpr simd_word operator<<(simd_word x, std::size_t n) noexcept {
+        return x <<= n;
+    }
+    friend constexpr simd_word operator<<(simd_word x, simd_word n) noexcept {
+        return x <<= n;
+    }
+    friend constexpr simd_word operator>>(simd_word x, std::size_t n) noexcept {
+        return x >>= n;
+    }
+    friend constexpr simd_word operator>>(simd_word x, simd_word n) noexcept {
+        return x >>= n;
+    }
+    constexpr simd_word& operator&=(simd_word other) noexcept;
+    constexpr simd_word& operator|=(simd_word other) noexcept;
+    constexpr simd_word& operator^=(simd_word other) noexcept;
+    constexpr simd_word& operator<<=(std::size_t n) noexcept;
+    constexpr simd_word& operator>>=(std::size_t n) noexcept;
+    constexpr simd_word& operator<<=(simd_word n) noexcept;
+    constexpr simd_word& operator>>=(simd_word n) noexcept;
+
+    // Arithmetic operators
+    public:
+    friend constexpr simd_word operator-(simd_word x) noexcept {
+        return simd_word() - x;
+    }
+    friend constexpr simd_word operator+(simd_word x, simd_word y) noexcept {
+        return x += y;
+    }
+    friend constexpr simd_word operator-(simd_word x, simd_word y) noexcept {
+        return x -= y;
+    }
+    friend constexpr simd_word operator*(simd_word x, simd_word y) noexcept {
+        return x *= y;
+    }
+    constexpr simd_word& operator+=(simd_word other) noexcept;
+    constexpr simd_word& operator-=(simd_word other) noexcept;
+    constexpr simd_word& operator*=(simd_word other) noexcept;
+    constexpr simd_word& operator++() noexcept;
+    constexpr simd_word& operator--() noexcept;
+    constexpr simd_word operator++(int) noexcept;
+    constexpr simd_word operator--(int) noexcept;
+
+    // Comparison operators
+    public:
+    friend constexpr bool operator==(simd_word x, simd_word y) noexcept {
+        limb_type difference = 0;
+        for (std::size_t i = 0; i < limbs; ++i) {
+            difference |= x._limbs[i] ^ y._limbs[i];
+        }
+        return !difference;
+    }
+    friend constexpr bool operator!=(simd_word x, simd_word y) noexcept {
+        return !(x == y);
+    }
+    friend constexpr bool operator<(simd_word x, simd_word y) noexcept {
+        std::size_t i = limbs - 1;
+        while (i > 0 && x._limbs[i] == y._limbs[i]) {
+            --i;
+        }
+        return x._limbs[i] < y._limbs[i];
+    }
+    friend constexpr bool operator>(simd_word x, simd_word y) noexcept {
+        return y < x;
+    }
+    friend constexpr bool operator<=(simd_word x, simd_word y) noexcept {
+        return !(y < x);
+    }
+    friend constexpr bool operator>=(simd_word x, simd_word y) noexcept {
+        return !(x < y);
+    }
+
+    // Implementation details: shift count and product of limbs
+    private:
+    constexpr std::size_t _count() const noexcept;
+    static constexpr void _multiply(limb_type x, limb_type y,
+        limb_type& high, limb_type& low) noexcept;
+
+    // Implementation details: data members
+    private:
+    limb_type _limbs[limbs];
+};
+
+// Binary digits of simd words
+template <std::size_t Bits>
+struct binary_digits<simd_word<Bits>>
+: std::integral_constant<std::size_t, Bits>
+{
+};
+/* ************************************************************************** */
+
+
+
+// ------------------------- SIMD WORD: LIFECYCLE --------------------------- //
+// Zero-initializes the word
+template <std::size_t Bits>
+constexpr simd_word<Bits>::simd_word() noexcept
+: _limbs()
+{
+}
+
+// Converts an integer as an unsigned integer would, by sign extension
+template <std::size_t Bits>
+template <class T, class>
+constexpr simd_word<Bits>::simd_word(T value) noexcept
+: _limbs()
+{
+    _limbs[0] = static_cast<limb_type>(value);
+    if constexpr (std::is_signed<T>::value) {
+        for (std::size_t i = 1; i < limbs; ++i) {
+            _limbs[i] = value < T() ? ~limb_type() : limb_type();
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SIMD WORD: CONVERSION -------------------------- //
+// Returns whether a bit of the word is set
+template <std::size_t Bits>
+constexpr simd_word<Bits>::operator bool() const noexcept
+{
+    return *this != simd_word();
+}
+
+// Converts to an integer, keeping the least significant bits
+template <std::size_t Bits>
+template <class T, class>
+constexpr simd_word<Bits>::operator T() const noexcept
+{
+    return static_cast<T>(_limbs[0]);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------------- SIMD WORD: ACCESS ---------------------------- //
+// Accesses the limb of index i, from the least significant one
+template <std::size_t Bits>
+constexpr typename simd_word<Bits>::limb_type&
+simd_word<Bits>::limb(std::size_t i) noexcept
+{
+    return _limbs[i];
+}
+
+template <std::size_t Bits>
+constexpr typename simd_word<Bits>::limb_type
+simd_word<Bits>::limb(std::size_t i) const noexcept
+{
+    return _limbs[i];
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// --------------------- SIMD WORD: BITWISE OPERATORS ----------------------- //
+// Applies a bitwise operation limb by limb
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator&=(
+    simd_word other) noexcept
+{
+    for (std::size_t i = 0; i < limbs; ++i) {
+        _limbs[i] &= other._limbs[i];
+    }
+    return *this;
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator|=(
+    simd_word other) noexcept
+{
+    for (std::size_t i = 0; i < limbs; ++i) {
+        _limbs[i] |= other._limbs[i];
+    }
+    return *this;
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator^=(
+    simd_word other) noexcept
+{
+    for (std::size_t i = 0; i < limbs; ++i) {
+        _limbs[i] ^= other._limbs[i];
+    }
+    return *this;
+}
+
+// Shifts by n bits: limbs move by n / 64 positions, each one receiving the
+// bits shifted out of its neighbour, and the word is cleared if n >= Bits
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator<<=(std::size_t n) noexcept
+{
+    const std::size_t q = n < Bits ? n / limb_digits : limbs;
+    const std::size_t r = n % limb_digits;
+    for (std::size_t i = limbs; i-- > 0;) {
+        limb_type limb = i >= q ? _limbs[i - q] << r : 0;
+        if (r && i > q) {
+            limb |= _limbs[i - q - 1] >> (limb_digits - r);
+        }
+        _limbs[i] = limb;
+    }
+    return *this;
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator>>=(std::size_t n) noexcept
+{
+    const std::size_t q = n < Bits ? n / limb_digits : limbs;
+    const std::size_t r = n % limb_digits;
+    for (std::size_t i = 0; i < limbs; ++i) {
+        limb_type limb = i + q < limbs ? _limbs[i + q] >> r : 0;
+        if (r && i + q + 1 < limbs) {
+            limb |= _limbs[i + q + 1] << (limb_digits - r);
+        }
+        _limbs[i] = limb;
+    }
+    return *this;
+}
+
+// Shifts by a word, saturated to Bits
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator<<=(simd_word n) noexcept
+{
+    return *this <<= n._count();
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator>>=(simd_word n) noexcept
+{
+    return *this >>= n._count();
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// -------------------- SIMD WORD: ARITHMETIC OPERATORS --------------------- //
+// Adds limb by limb, propagating the carry
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator+=(
+    simd_word other) noexcept
+{
+    limb_type carry = 0;
+    for (std::size_t i = 0; i < limbs; ++i) {
+        const limb_type sum = _limbs[i] + other._limbs[i];
+        const limb_type result = sum + carry;
+        carry = (sum < _limbs[i]) | (result < sum);
+        _limbs[i] = result;
+    }
+    return *this;
+}
+
+// Subtracts limb by limb, propagating the borrow
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator-=(
+    simd_word other) noexcept
+{
+    limb_type borrow = 0;
+    for (std::size_t i = 0; i < limbs; ++i) {
+        const limb_type difference = _limbs[i] - other._limbs[i];
+        const limb_type result = difference - borrow;
+        borrow = (difference > _limbs[i]) | (result > difference);
+        _limbs[i] = result;
+    }
+    return *this;
+}
+
+// Multiplies modulo 2^Bits, summing the products of limbs whose weight is
+// lower than the size of the word
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator*=(
+    simd_word other) noexcept
+{
+    simd_word result;
+    for (std::size_t i = 0; i < limbs; ++i) {
+        limb_type carry = 0;
+        for (std::size_t j = 0; i + j < limbs; ++j) {
+            limb_type high = 0;
+            limb_type low = 0;
+            _multiply(_limbs[i], other._limbs[j], high, low);
+            low += carry;
+            high += low < carry;
+            result._limbs[i + j] += low;
+            high += result._limbs[i + j] < low;
+            carry = high;
+        }
+    }
+    return *this = result;
+}
+
+// Increments and decrements
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator++() noexcept
+{
+    return *this += simd_word(1);
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits>& simd_word<Bits>::operator--() noexcept
+{
+    return *this -= simd_word(1);
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits> simd_word<Bits>::operator++(int) noexcept
+{
+    simd_word old = *this;
+    ++*this;
+    return old;
+}
+
+template <std::size_t Bits>
+constexpr simd_word<Bits> simd_word<Bits>::operator--(int) noexcept
+{
+    simd_word old = *this;
+    --*this;
+    return old;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------ SIMD WORD: IMPLEMENTATION DETAILS --------------------- //
+// Returns the word as a shift count, saturated to Bits
+template <std::size_t Bits>
+constexpr std::size_t simd_word<Bits>::_count() const noexcept
+{
+    limb_type high = 0;
+    for (std::size_t i = 1; i < limbs; ++i) {
+        high |= _limbs[i];
+    }
+    return high || _limbs[0] > Bits ? Bits : _limbs[0];
+}
+
+// Computes the 128-bit product of two limbs from their 32-bit halves
+template <std::size_t Bits>
+constexpr void simd_word<Bits>::_multiply(limb_type x, limb_type y,
+    limb_type& high, limb_type& low) noexcept
+{
+    constexpr limb_type half = 0xffffffff;
+    const limb_type low_low = (x & half) * (y & half);
+    const limb_type low_high = (x & half) * (y >> 32);
+    const limb_type high_low = (x >> 32) * (y & half);
+    const limb_type high_high = (x >> 32) * (y >> 32);
+    const limb_type middle = (low_low >> 32) + (low_high & half)
+        + (high_low & half);
+    low = (middle << 32) | (low_low & half);
+    high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ------------------------- SIMD WORD: INSTRUCTIONS ------------------------ //
+// Counts the set bits of the limbs
+template <std::size_t Bits>
+constexpr std::size_t _popcnt(simd_word<Bits> src) noexcept
+{
+    std::size_t result = 0;
+    for (std::size_t i = 0; i < simd_word<Bits>::limbs; ++i) {
+        result += __builtin_popcountll(src.limb(i));
+    }
+    return result;
+}
+
+// Counts the trailing zeros up to the first limb with a set bit
+template <std::size_t Bits>
+constexpr std::size_t _tzcnt(simd_word<Bits> src) noexcept
+{
+    for (std::size_t i = 0; i < simd_word<Bits>::limbs; ++i) {
+        if (src.limb(i)) {
+            return i * simd_word<Bits>::limb_digits
+                + __builtin_ctzll(src.limb(i));
+        }
+    }
+    return Bits;
+}
+
+// Counts the leading zeros down to the last limb with a set bit
+template <std::size_t Bits>
+constexpr std::size_t _lzcnt(simd_word<Bits> src) noexcept
+{
+    for (std::size_t i = simd_word<Bits>::limbs; i-- > 0;) {
+        if (src.limb(i)) {
+            return (simd_word<Bits>::limbs - 1 - i)
+                * simd_word<Bits>::limb_digits
+                + __builtin_clzll(src.limb(i));
+        }
+    }
+    return Bits;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+} // namespace bit
+
+// Numeric limits of simd words, as the ones of unsigned integers
+namespace std {
+template <std::size_t Bits>
+class numeric_limits<bit::simd_word<Bits>>
+: public numeric_limits<std::uint64_t>
+{
+    public:
+    static constexpr int digits = static_cast<int>(Bits);
+    static constexpr int digits10 = static_cast<int>(Bits * 643 / 2136);
+    static constexpr bit::simd_word<Bits> min() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> lowest() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> max() noexcept {
+        return ~bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> epsilon() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> round_error() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> infinity() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> quiet_NaN() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> signaling_NaN() noexcept {
+        return bit::simd_word<Bits>();
+    }
+    static constexpr bit::simd_word<Bits> denorm_min() noexcept {
+        return bit::simd_word<Bits>();
+    }
+};
+} // namespace std
+
+#endif // _SIMD_WORD_HPP_INCLUDED
+// ========================================================================== //
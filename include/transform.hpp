@@ -12,7 +12,14 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <algorithm>
+#include <climits>
+#include <functional>
+#include <iterator>
+#include <type_traits>
 // Project sources
+#include "bit_algorithm_details.hpp"
+#include "execution.hpp"
 // Third-party libraries
 // Miscellaneous
 
@@ -21,43 +28,224 @@ namespace bit {
 
 
 
-// Status: on hold
+// --------------------------- Transform Details ---------------------------- //
+// Writes count full words to address using store, word i being op applied to
+// the words of the sources starting i words after their first bit
+template <class WordType, class Store, class Operation, class... Iterators>
+void _transform_full_words(WordType* address, std::ptrdiff_t count,
+    Store&& store, Operation&& op, bit_iterator<Iterators>... sources) {
+    constexpr std::size_t digits = binary_digits<WordType>::value;
+    if constexpr ((std::is_same<WordType,
+                   typename bit_iterator<Iterators>::word_type>::value && ...)) {
+        if (((sources.position() == 0) && ...)) {
+            for (std::ptrdiff_t i = 0; i < count; ++i) {
+                store(address + i, static_cast<WordType>(
+                    op(static_cast<WordType>(sources.base()[i])...)));
+            }
+            return;
+        }
+    }
+    for (std::ptrdiff_t i = 0; i < count; ++i) {
+        store(address + i, static_cast<WordType>(
+            op(get_full_word<WordType>(sources)...)));
+        ((sources += digits), ...);
+    }
+}
+
+// Runs kernel(offset, chunk_first, chunk_last) on the chunks of the output
+// [d_first, d_last) in parallel, offset being the distance of the chunk from
+// d_first. When the output is contiguous, the kernel only handles the partial
+// words at the ends of a chunk, and words(offset, address, count, store)
+// writes its full words, with non-temporal stores when the output is larger
+// than the last level cache
+template <bool Contiguous, class ExecutionPolicy, class OutputIt,
+    class Kernel, class Words>
+bit_iterator<OutputIt> _parallel_transform(const ExecutionPolicy& policy,
+    bit_iterator<OutputIt> d_first, bit_iterator<OutputIt> d_last,
+    Kernel&& kernel, Words&& words) {
+
+    // Types and constants
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+    using difference_type = typename bit_iterator<OutputIt>::difference_type;
+    constexpr difference_type digits = binary_digits<word_type>::value;
+
+    // Initialization
+    const difference_type n = bit::distance(d_first, d_last);
+    const bool streaming = _is_streamable<OutputIt>::value
+        && static_cast<std::size_t>(n) / CHAR_BIT > _non_temporal_threshold();
+
+    // Transforms every chunk
+    _parallel_for_each_chunk(policy, d_first, d_last,
+        [&](bit_iterator<OutputIt> chunk_first,
+            bit_iterator<OutputIt> chunk_last) {
+            const difference_type offset = bit::distance(d_first, chunk_first);
+            if constexpr (Contiguous) {
+                const difference_type size = bit::distance(chunk_first,
+                    chunk_last);
+                const difference_type head = chunk_first.position()
+                    ? std::min<difference_type>(size,
+                        digits - chunk_first.position())
+                    : 0;
+                const difference_type count = (size - head) / digits;
+                const difference_type tail = head + count * digits;
+                kernel(offset, chunk_first, chunk_first + head);
+                if (count) {
+                    word_type* address = std::addressof(
+                        *(chunk_first + head).base());
+                    if (streaming) {
+                        words(offset + head, address, count,
+                            [](word_type* it, word_type value) {
+                                _stream_store(it, value);
+                            });
+                        _stream_fence();
+                    } else {
+                        words(offset + head, address, count,
+                            [](word_type* it, word_type value) {
+                                *it = value;
+                            });
+                    }
+                }
+                kernel(offset + tail, chunk_first + tail, chunk_last);
+            } else {
+                kernel(offset, chunk_first, chunk_last);
+            }
+        });
+    return d_last;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// Status: complete
+// Negations are applied to whole words, other operations bit by bit
 template <class InputIt, class OutputIt, class UnaryOperation>
-constexpr bit_iterator<OutputIt> transform(bit_iterator<InputIt> first1,
+bit_iterator<OutputIt> transform(bit_iterator<InputIt> first1,
     bit_iterator<InputIt> last1, bit_iterator<OutputIt> d_first,
     UnaryOperation unary_op) {
-    (first1, last1, unary_op);
-    return d_first;
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    _assert_range_viability(first1, last1);
+    if constexpr (std::is_same<UnaryOperation, std::bit_not<>>::value
+               || std::is_same<UnaryOperation, std::logical_not<>>::value) {
+        const size_type n = bit::distance(first1, last1);
+        _transform_words(first1, last1, d_first,
+            [](word_type word, size_type) {
+                return static_cast<word_type>(~word);
+            });
+        return d_first + n;
+    } else {
+        return std::transform(first1, last1, d_first, unary_op);
+    }
 }
 
-// Status: on hold
+// Status: complete
+// Chunks of the output are transformed in parallel, see the binary overload
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2,
-    class UnaryOperation> bit_iterator<ForwardIt2> transform(ExecutionPolicy&& policy,
+    class UnaryOperation, class = std::enable_if_t<
+        !_is_bit_iterator<std::decay_t<ExecutionPolicy>>::value>>
+bit_iterator<ForwardIt2> transform(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first1, bit_iterator<ForwardIt1> last1,
     bit_iterator<ForwardIt2> d_first, UnaryOperation unary_op) {
-    (policy, first1, last1, unary_op);
-    return d_first;
+    using word_type = typename bit_iterator<ForwardIt2>::word_type;
+    using difference_type = typename bit_iterator<ForwardIt2>::difference_type;
+    using category = typename bit_iterator<ForwardIt1>::iterator_category;
+    _assert_range_viability(first1, last1);
+    if constexpr (std::is_same<UnaryOperation, std::bit_not<>>::value
+               || std::is_same<UnaryOperation, std::logical_not<>>::value) {
+        constexpr bool contiguous = _is_contiguous_iterator<ForwardIt2>::value
+            && std::is_base_of<std::random_access_iterator_tag,
+                               category>::value;
+        return _parallel_transform<contiguous>(policy, d_first,
+            d_first + bit::distance(first1, last1),
+            [first1, unary_op](difference_type offset,
+                bit_iterator<ForwardIt2> chunk_first,
+                bit_iterator<ForwardIt2> chunk_last) {
+                const auto source = std::next(first1, offset);
+                bit::transform(source, std::next(source,
+                    bit::distance(chunk_first, chunk_last)), chunk_first,
+                    unary_op);
+            },
+            [first1](difference_type offset, word_type* address,
+                difference_type count, auto store) {
+                _transform_full_words(address, count, store,
+                    [](word_type word) {
+                        return static_cast<word_type>(~word);
+                    }, std::next(first1, offset));
+            });
+    } else {
+        static_cast<void>(policy);
+        return bit::transform(first1, last1, d_first, unary_op);
+    }
 }
 
-// Status: on hold
+// Status: complete
+// Bitwise operations are applied to whole words, other operations bit by bit
 template <class InputIt1, class InputIt2, class OutputIt, class BinaryOperation>
-constexpr bit_iterator<OutputIt> transform(bit_iterator<InputIt1> first1,
+bit_iterator<OutputIt> transform(bit_iterator<InputIt1> first1,
     bit_iterator<InputIt1> last1, bit_iterator<InputIt2> first2,
     bit_iterator<OutputIt> d_first, BinaryOperation binary_op) {
-    (first1, last1, first2, binary_op); 
-    return d_first;
+    using word_type = typename bit_iterator<OutputIt>::word_type;
+    using size_type = typename bit_iterator<OutputIt>::size_type;
+    _assert_range_viability(first1, last1);
+    if constexpr (_bitwise_operation<BinaryOperation>::value) {
+        const size_type n = bit::distance(first1, last1);
+        _transform_words(first1, last1, d_first,
+            [&first2](word_type word, size_type len) {
+                const word_type other = get_word<word_type>(first2, len);
+                std::advance(first2, len);
+                return _bitwise_operation<BinaryOperation>::apply(word, other);
+            });
+        return d_first + n;
+    } else {
+        return std::transform(first1, last1, first2, d_first, binary_op);
+    }
 }
 
-// Status: on hold
+// Status: complete
+// Chunks of the output are paired with the bits of the inputs at the same
+// distance and transformed in parallel. Full words of outputs larger than
+// the last level cache are written with non-temporal stores
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class ForwardIt3,
     class BinaryOperation> bit_iterator<ForwardIt3> transform(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first1, bit_iterator<ForwardIt1> last1,
     bit_iterator<ForwardIt2> first2, bit_iterator<ForwardIt3> d_first, 
     BinaryOperation binary_op) {
-    (policy, first1, last1, first2, binary_op);
-    return d_first;
+    using word_type = typename bit_iterator<ForwardIt3>::word_type;
+    using difference_type = typename bit_iterator<ForwardIt3>::difference_type;
+    using category1 = typename bit_iterator<ForwardIt1>::iterator_category;
+    using category2 = typename bit_iterator<ForwardIt2>::iterator_category;
+    _assert_range_viability(first1, last1);
+    if constexpr (_bitwise_operation<BinaryOperation>::value) {
+        constexpr bool contiguous = _is_contiguous_iterator<ForwardIt3>::value
+            && std::is_base_of<std::random_access_iterator_tag,
+                               category1>::value
+            && std::is_base_of<std::random_access_iterator_tag,
+                               category2>::value;
+        return _parallel_transform<contiguous>(policy, d_first,
+            d_first + bit::distance(first1, last1),
+            [first1, first2, binary_op](difference_type offset,
+                bit_iterator<ForwardIt3> chunk_first,
+                bit_iterator<ForwardIt3> chunk_last) {
+                const auto source = std::next(first1, offset);
+                bit::transform(source, std::next(source,
+                    bit::distance(chunk_first, chunk_last)),
+                    std::next(first2, offset), chunk_first, binary_op);
+            },
+            [first1, first2](difference_type offset, word_type* address,
+                difference_type count, auto store) {
+                _transform_full_words(address, count, store,
+                    _bitwise_operation<BinaryOperation>::template
+                        apply<word_type>,
+                    std::next(first1, offset), std::next(first2, offset));
+            });
+    } else {
+        static_cast<void>(policy);
+        return bit::transform(first1, last1, first2, d_first, binary_op);
+    }
 }
 
+
+
 // ========================================================================== //
 } // namespace bit
 
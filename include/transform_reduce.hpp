@@ -12,6 +12,7 @@
 
 // ============================== PREAMBLE ================================== //
 // C++ standard library
+#include <numeric>
 // Project sources
 // Third-party libraries
 // Miscellaneous
@@ -21,53 +22,97 @@ namespace bit {
 
 
 
-// Status: will not implement?
+// Status: complete
+// Products of bits are conjunctions: the result is init plus popcount(a & b)
 template <class InputIt1, class InputIt2, class T>
 T transform_reduce(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2, T init) {
-    (first1, last1, first2);
-    return init;
+    _assert_range_viability(first1, last1);
+    return init + _count_transform<std::bit_and<>>(first1, last1, first2);
 }
 
-// Status: on hold
+// Status: complete
+// A sum of bitwise operations is computed as popcount(a op b) in one pass,
+// other operations are folded bit by bit
 template <class InputIt1, class InputIt2, class T, class BinaryOp1, class BinaryOp2>
 T transform_reduce(bit_iterator<InputIt1> first1, bit_iterator<InputIt1> last1,
     bit_iterator<InputIt2> first2, T init, BinaryOp1 binary_op1, BinaryOp2 binary_op2) {
-    (first1, last1, first2, binary_op1, binary_op2);
-    return init;    
+    _assert_range_viability(first1, last1);
+    if constexpr (_is_plus<BinaryOp1>::value 
+                  && _bitwise_operation<BinaryOp2>::value) {
+        return init + _count_transform<BinaryOp2>(first1, last1, first2);
+    } else {
+        return std::inner_product(first1, last1, first2, init, binary_op1,
+            binary_op2);
+    }
 }
 
-// Status: on hold
+// Status: complete
+// A sum of negated bits is the number of unset bits, other operations are
+// folded bit by bit
 template <class InputIt, class T, class BinaryOp, class UnaryOp>
 T transform_reduce(bit_iterator<InputIt> first, bit_iterator<InputIt> last, T init,
     BinaryOp binop, UnaryOp unary_op) {
-    (first, last, binop, unary_op);
-    return init;
+    if constexpr (_is_plus<BinaryOp>::value 
+                  && (std::is_same<UnaryOp, std::bit_not<>>::value
+                   || std::is_same<UnaryOp, std::logical_not<>>::value)) {
+        return init + bit::count(first, last, bit0);
+    } else {
+        for (; first != last; ++first) {
+            init = binop(init, unary_op(*first));
+        }
+        return init;
+    }
 }
 
-// Status: will not implement?
-template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
-T transform_reduce(ExecutionPolicy&& policy, bit_iterator<ForwardIt1> first1,
-    bit_iterator<ForwardIt1> last1, bit_iterator<ForwardIt2> first2, T init) {
-    (policy, first1, last1, first2);
-    return init;
-}
-
-// Status: on hold
+// Status: complete
+// Chunks of the first range are paired with the bits of the second range at
+// the same distance, counted in parallel, and their counts summed
 template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T,
     class BinaryOp1, class BinaryOp2> T transform_reduce(ExecutionPolicy&& policy,
     bit_iterator<ForwardIt1> first1, bit_iterator<ForwardIt1> last1,
     bit_iterator<ForwardIt2> first2, T init, BinaryOp1 binary_op1, BinaryOp2 binary_op2) {
-    (policy, first1, last1, first2, binary_op1, binary_op2);
-    return init;
+    using difference_type = typename bit_iterator<ForwardIt1>::difference_type;
+    if constexpr (_is_plus<BinaryOp1>::value 
+                  && _bitwise_operation<BinaryOp2>::value) {
+        _assert_range_viability(first1, last1);
+        return init + _parallel_reduce(policy, first1, last1, 
+            difference_type(0), 
+            [first1, first2](bit_iterator<ForwardIt1> chunk_first,
+                             bit_iterator<ForwardIt1> chunk_last) {
+                return _count_transform<BinaryOp2>(chunk_first, chunk_last,
+                    first2 + bit::distance(first1, chunk_first));
+            }, std::plus<difference_type>());
+    } else {
+        static_cast<void>(policy);
+        return bit::transform_reduce(first1, last1, first2, init, binary_op1,
+            binary_op2);
+    }
+}
+
+// Status: complete
+template <class ExecutionPolicy, class ForwardIt1, class ForwardIt2, class T>
+T transform_reduce(ExecutionPolicy&& policy, bit_iterator<ForwardIt1> first1,
+    bit_iterator<ForwardIt1> last1, bit_iterator<ForwardIt2> first2, T init) {
+    return bit::transform_reduce(policy, first1, last1, first2, init,
+        std::plus<>(), std::bit_and<>());
 }
 
-// Status: on hold
-template <class ExecutionPolicy, class ForwardIt, class T, class BinaryOp, class UnaryOp>
+// Status: complete
+template <class ExecutionPolicy, class ForwardIt, class T, class BinaryOp,
+    class UnaryOp, class = std::enable_if_t<
+        !_is_bit_iterator<std::decay_t<ExecutionPolicy>>::value>>
 T transform_reduce(ExecutionPolicy&& policy, bit_iterator<ForwardIt> first,
     bit_iterator<ForwardIt> last, T init, BinaryOp binary_op, UnaryOp unary_op) {
-    (policy, first, last, binary_op, unary_op);
-    return init;
+    if constexpr (_is_plus<BinaryOp>::value 
+                  && (std::is_same<UnaryOp, std::bit_not<>>::value
+                   || std::is_same<UnaryOp, std::logical_not<>>::value)) {
+        return init + (bit::distance(first, last) 
+            - bit::reduce(policy, first, last));
+    } else {
+        static_cast<void>(policy);
+        return bit::transform_reduce(first, last, init, binary_op, unary_op);
+    }
 }
 
 // ========================================================================== //
@@ -0,0 +1,130 @@
+// ============================ COUNT BENCHMARK ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            count.cc
+// Description:     Bandwidth of the count kernels, and scaling of the
+//                  parallel count with the number of threads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <thread>
+#include <vector>
+// Project sources
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------ Count Scaling ----------------------------- //
+// Usage: count [number of bits] [number of repetitions]
+int main(int argc, char* argv[]) {
+
+    // Types and constants
+    using word_type = std::uint64_t;
+    using iterator_type = std::vector<word_type>::iterator;
+    using clock = std::chrono::steady_clock;
+    constexpr std::size_t digits = bit::binary_digits<word_type>::value;
+
+    // Initialization
+    const std::size_t bits = argc > 1 
+        ? std::strtoull(argv[1], nullptr, 10) 
+        : std::size_t(1) << 31;
+    const std::size_t repetitions = argc > 2 
+        ? std::strtoull(argv[2], nullptr, 10) 
+        : 5;
+    const std::size_t hardware = std::max(
+        std::thread::hardware_concurrency(), 1u);
+    std::vector<word_type> words(bits / digits + 1);
+    std::mt19937_64 engine(42);
+    std::generate(words.begin(), words.end(), engine);
+    bit::bit_iterator<iterator_type> first(words.begin(), 3);
+    bit::bit_iterator<iterator_type> last = first + bits;
+
+    // Thread counts: powers of two, then all cores
+    std::vector<std::size_t> concurrencies;
+    for (std::size_t n = 1; n < hardware; n *= 2) {
+        concurrencies.push_back(n);
+    }
+    concurrencies.push_back(hardware);
+
+    // Keeps the best of the repetitions for each available kernel
+    const bit::instruction_set active = bit::active_instruction_set();
+    const bit::instruction_set sets[] = {
+        bit::instruction_set::scalar, bit::instruction_set::bmi2,
+        bit::instruction_set::avx2, bit::instruction_set::avx512
+    };
+    const char* names[] = {"scalar", "bmi2", "avx2", "avx512"};
+    double reference = 0;
+    std::cout << std::setw(8) << "kernel" << std::setw(12) << "ms" 
+              << std::setw(12) << "GB/s" << std::setw(10) << "speedup" 
+              << std::setw(14) << "count" << std::endl;
+    for (std::size_t k = 0; k < 4; ++k) {
+        if (bit::set_instruction_set(sets[k]) != sets[k]) {
+            break;
+        }
+        double best = 0;
+        std::ptrdiff_t result = 0;
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start = clock::now();
+            result = bit::count(first, last, bit::bit1);
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        if (k == 0) {
+            reference = best;
+        }
+        std::cout << std::setw(8) << names[k] 
+                  << std::setw(12) << std::fixed << std::setprecision(2) 
+                  << best * 1e3
+                  << std::setw(12) << bits / 8 / best / 1e9 
+                  << std::setw(10) << reference / best 
+                  << std::setw(14) << result << std::endl;
+    }
+    bit::set_instruction_set(active);
+    std::cout << std::endl;
+
+    // Keeps the best of the repetitions for each thread count
+    std::cout << std::setw(8) << "threads" << std::setw(12) << "ms" 
+              << std::setw(12) << "GB/s" << std::setw(10) << "speedup" 
+              << std::setw(14) << "count" << std::endl;
+    for (std::size_t concurrency: concurrencies) {
+        double best = 0;
+        std::ptrdiff_t result = 0;
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start = clock::now();
+            result = bit::count(bit::execution::par(concurrency), 
+                first, last, bit::bit1);
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        if (concurrency == 1) {
+            reference = best;
+        }
+        std::cout << std::setw(8) << concurrency 
+                  << std::setw(12) << std::fixed << std::setprecision(2) 
+                  << best * 1e3
+                  << std::setw(12) << bits / 8 / best / 1e9 
+                  << std::setw(10) << reference / best 
+                  << std::setw(14) << result << std::endl;
+    }
+    return 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
@@ -0,0 +1,94 @@
+// ============================ FIND BENCHMARK ============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            find.cc
+// Description:     Bandwidth of the find kernels on a sparse bitmap
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+// Project sources
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------ Find Kernels ------------------------------ //
+// Usage: find [number of bits] [number of repetitions]
+int main(int argc, char* argv[]) {
+
+    // Types and constants
+    using word_type = std::uint64_t;
+    using iterator_type = std::vector<word_type>::iterator;
+    using clock = std::chrono::steady_clock;
+    constexpr std::size_t digits = bit::binary_digits<word_type>::value;
+
+    // Initialization
+    const std::size_t bits = argc > 1 
+        ? std::strtoull(argv[1], nullptr, 10) 
+        : std::size_t(1) << 31;
+    const std::size_t repetitions = argc > 2 
+        ? std::strtoull(argv[2], nullptr, 10) 
+        : 5;
+    std::vector<word_type> words(bits / digits + 1);
+    bit::bit_iterator<iterator_type> first(words.begin(), 3);
+    bit::bit_iterator<iterator_type> last = first + bits;
+    std::mt19937_64 engine(42);
+    last[-1 - static_cast<std::ptrdiff_t>(engine() % 64)] = bit::bit1;
+
+    // Keeps the best of the repetitions for each available kernel, on a
+    // range whose only set bit is in its last word
+    const bit::instruction_set active = bit::active_instruction_set();
+    const bit::instruction_set sets[] = {
+        bit::instruction_set::scalar, bit::instruction_set::bmi2,
+        bit::instruction_set::avx2, bit::instruction_set::avx512
+    };
+    const char* names[] = {"scalar", "bmi2", "avx2", "avx512"};
+    double reference = 0;
+    std::cout << std::setw(8) << "kernel" << std::setw(12) << "ms" 
+              << std::setw(12) << "GB/s" << std::setw(10) << "speedup" 
+              << std::endl;
+    for (std::size_t k = 0; k < 4; ++k) {
+        if (bit::set_instruction_set(sets[k]) != sets[k]) {
+            break;
+        }
+        double best = 0;
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start = clock::now();
+            if (bit::find(first, last, bit::bit1) == last) {
+                return 1;
+            }
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        if (k == 0) {
+            reference = best;
+        }
+        std::cout << std::setw(8) << names[k] 
+                  << std::setw(12) << std::fixed << std::setprecision(2) 
+                  << best * 1e3
+                  << std::setw(12) << bits / 8 / best / 1e9 
+                  << std::setw(10) << reference / best << std::endl;
+    }
+    bit::set_instruction_set(active);
+    return 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
@@ -0,0 +1,113 @@
+// ============================ PDEP BENCHMARK ============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            pdep.cc
+// Description:     Latency of the strategies of bit deposit and extract
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+// Project sources
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------- Deposit and Extract ---------------------------- //
+// Usage: pdep [number of calls] [number of repetitions]
+int main(int argc, char* argv[]) {
+
+    // Types and constants
+    using word_type = std::uint64_t;
+    using function_type = word_type (*)(word_type, word_type);
+    using clock = std::chrono::steady_clock;
+    constexpr std::size_t masks = 1024;
+
+    // Initialization
+    const std::size_t calls = argc > 1
+        ? std::strtoull(argv[1], nullptr, 10)
+        : std::size_t(1) << 24;
+    const std::size_t repetitions = argc > 2
+        ? std::strtoull(argv[2], nullptr, 10)
+        : 5;
+    std::mt19937_64 engine(42);
+    std::vector<function_type> functions = {
+        bit::_pdep_loop, bit::_pdep_block, bit::_pdep_scalar,
+        bit::_pext_loop, bit::_pext_block, bit::_pext_scalar
+    };
+    std::vector<const char*> names = {
+        "pdep loop", "pdep block", "pdep scalar",
+        "pext loop", "pext block", "pext scalar"
+    };
+#if defined(_BIT_X86_DISPATCH)
+    if (bit::detected_instruction_set() >= bit::instruction_set::bmi2) {
+        functions.insert(functions.begin() + 3, bit::_pdep_bmi2);
+        names.insert(names.begin() + 3, "pdep bmi2");
+        functions.push_back(bit::_pext_bmi2);
+        names.push_back("pext bmi2");
+    }
+#endif
+
+    // Chains dependent calls on masks with 8, 32 and 56 set bits on average,
+    // keeping the best of the repetitions
+    const unsigned densities[] = {8, 32, 56};
+    std::cout << std::setw(12) << "strategy";
+    for (unsigned density : densities) {
+        std::cout << std::setw(8) << density << " ns";
+    }
+    std::cout << std::endl;
+    for (std::size_t f = 0; f < functions.size(); ++f) {
+        std::cout << std::setw(12) << names[f];
+        for (unsigned density : densities) {
+            std::bernoulli_distribution bit_distribution(density / 64.);
+            std::vector<word_type> msk(masks);
+            for (word_type& m : msk) {
+                for (unsigned i = 0; i < 64; ++i) {
+                    m |= word_type(bit_distribution(engine)) << i;
+                }
+            }
+            double best = 0;
+            word_type x = engine();
+            for (std::size_t i = 0; i < repetitions; ++i) {
+                const auto start = clock::now();
+                for (std::size_t j = 0; j < calls; ++j) {
+                    x = functions[f](x ^ j, msk[j % masks]);
+                }
+                const std::chrono::duration<double> elapsed
+                    = clock::now() - start;
+                best = i == 0
+                    ? elapsed.count()
+                    : std::min(best, elapsed.count());
+            }
+            std::cout << std::setw(11) << std::fixed << std::setprecision(2)
+                      << best / calls * 1e9;
+            if (x == 42) {
+                std::cout << " ";
+            }
+        }
+        std::cout << std::endl;
+    }
+    std::cout << "selected: "
+              << (bit::_kernels().pdep == bit::_pdep_scalar ? "scalar" : "bmi2")
+              << std::endl;
+    return 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
@@ -0,0 +1,109 @@
+// ========================== TRANSFORM BENCHMARK =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            transform.cc
+// Description:     Bandwidth of the parallel transform with and without
+//                  non-temporal stores
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+// Project sources
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// -------------------------- Transform Bandwidth --------------------------- //
+// Usage: transform [number of bits] [number of repetitions] [threads]
+int main(int argc, char* argv[]) {
+
+    // Types and constants
+    using word_type = std::uint64_t;
+    using iterator_type = std::vector<word_type>::iterator;
+    using clock = std::chrono::steady_clock;
+    constexpr std::size_t digits = bit::binary_digits<word_type>::value;
+
+    // Initialization
+    const std::size_t bits = argc > 1
+        ? std::strtoull(argv[1], nullptr, 10)
+        : std::size_t(1) << 31;
+    const std::size_t repetitions = argc > 2
+        ? std::strtoull(argv[2], nullptr, 10)
+        : 5;
+    const std::size_t concurrency = argc > 3
+        ? std::strtoull(argv[3], nullptr, 10)
+        : std::max(std::thread::hardware_concurrency(), 1u);
+    std::vector<word_type> lhs(bits / digits + 1);
+    std::vector<word_type> rhs(bits / digits + 1);
+    std::vector<word_type> out(bits / digits + 1);
+    std::mt19937_64 engine(42);
+    std::generate(lhs.begin(), lhs.end(), std::ref(engine));
+    std::generate(rhs.begin(), rhs.end(), std::ref(engine));
+    bit::bit_iterator<iterator_type> first1(lhs.begin());
+    bit::bit_iterator<iterator_type> last1 = first1 + bits;
+    bit::bit_iterator<iterator_type> first2(rhs.begin());
+    bit::bit_iterator<iterator_type> d_first(out.begin());
+
+    // Regular stores, then non-temporal stores above the cache size
+    const std::size_t threshold = bit::_non_temporal_threshold();
+    const std::size_t thresholds[] = {
+        std::numeric_limits<std::size_t>::max(), threshold
+    };
+    const char* names[] = {"regular", "streaming"};
+
+    // Keeps the best of the repetitions for each kind of store: the three
+    // ranges are moved through memory, and the output written once
+    double reference = 0;
+    std::cout << "threads: " << concurrency << ", last level cache: "
+              << threshold / 1024 << " KiB" << std::endl;
+    std::cout << std::setw(10) << "stores" << std::setw(12) << "ms"
+              << std::setw(12) << "GB/s" << std::setw(10) << "speedup"
+              << std::setw(14) << "count" << std::endl;
+    for (std::size_t k = 0; k < 2; ++k) {
+        bit::_non_temporal_threshold() = thresholds[k];
+        double best = 0;
+        for (std::size_t i = 0; i < repetitions; ++i) {
+            const auto start = clock::now();
+            bit::transform(bit::execution::par(concurrency), first1, last1,
+                first2, d_first, std::bit_xor<>());
+            const std::chrono::duration<double> elapsed = clock::now() - start;
+            best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+        }
+        if (k == 0) {
+            reference = best;
+        }
+        std::cout << std::setw(10) << names[k]
+                  << std::setw(12) << std::fixed << std::setprecision(2)
+                  << best * 1e3
+                  << std::setw(12) << 3 * bits / 8 / best / 1e9
+                  << std::setw(10) << reference / best
+                  << std::setw(14) << bit::count(d_first, d_first + bits,
+                                                 bit::bit1)
+                  << std::endl;
+    }
+    bit::_non_temporal_threshold() = threshold;
+    return 0;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
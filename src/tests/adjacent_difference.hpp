@@ -0,0 +1,91 @@
+// ======================= ADJACENT DIFFERENCE TESTS ======================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            adjacent_difference.hpp
+// Description:     Tests for adjacent_difference bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ADJACENT_DIFFERENCE_TESTS_HPP_INCLUDED
+#define _ADJACENT_DIFFERENCE_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------ Adjacent Difference Tests ----------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("adjacent_difference: writes the transition map", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    auto container_size = 4;
+    auto digits = bit::binary_digits<num_type>::value;
+    container_type bitcont1 = make_random_container<container_type>
+                                     (container_size); 
+    container_type bitcont2 = make_random_container<container_type>
+                                     (container_size); 
+    auto boolcont1 = bitcont_to_boolcont(bitcont1);
+    auto boolcont2 = bitcont_to_boolcont(bitcont2);
+    auto bfirst1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto blast1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto bfirst2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto blast2 = bit::bit_iterator<decltype(std::end(bitcont2))>(std::end(bitcont2));
+    auto bool_first1 = std::begin(boolcont1);
+    auto bool_last1 = std::end(boolcont1);
+    auto bool_first2 = std::begin(boolcont2);
+    auto bool_last2 = std::end(boolcont2);
+    auto difference = [](bool b1, bool b2) {return b1 != b2;};
+
+    auto bret = bit::adjacent_difference(bfirst1, blast1, bfirst2);
+    std::adjacent_difference(bool_first1, bool_last1, bool_first2, difference);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == blast2);
+
+    auto bfirst1_t = std::next(bfirst1, 5);
+    auto blast1_t = std::next(bfirst1, 3 * digits - 2);
+    auto bfirst2_t = std::next(bfirst2, 3);
+    auto bool_first1_t = std::next(bool_first1, 5);
+    auto bool_last1_t = std::next(bool_first1, 3 * digits - 2);
+    auto bool_first2_t = std::next(bool_first2, 3);
+    bret = bit::adjacent_difference(bfirst1_t, blast1_t, bfirst2_t);
+    std::adjacent_difference(bool_first1_t, bool_last1_t, bool_first2_t, 
+        difference);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == std::next(bfirst2_t, 3 * digits - 7));
+
+    bfirst2_t = std::next(bfirst2, digits + 1);
+    bool_first2_t = std::next(bool_first2, digits + 1);
+    blast1_t = std::next(bfirst1_t, 4);
+    bool_last1_t = std::next(bool_first1_t, 4);
+    bret = bit::adjacent_difference(bfirst1_t, blast1_t, bfirst2_t);
+    std::adjacent_difference(bool_first1_t, bool_last1_t, bool_first2_t, 
+        difference);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == std::next(bfirst2_t, 4));
+
+    // An empty range leaves d_first in place, at any position in its word
+    bret = bit::adjacent_difference(bfirst1_t, bfirst1_t, bfirst2_t);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == bfirst2_t);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _ADJACENT_DIFFERENCE_TESTS_HPP_INCLUDED
+// ========================================================================== //
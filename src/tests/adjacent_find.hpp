@@ -0,0 +1,87 @@
+// ========================== ADJACENT FIND TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            adjacent_find.hpp
+// Description:     Tests for adjacent_find bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ADJACENT_FIND_TESTS_HPP_INCLUDED
+#define _ADJACENT_FIND_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// --------------------------- Adjacent Find Tests -------------------------- //
+TEMPLATE_TEST_CASE("adjacent_find: is correct for single words", 
+    "[adjacent_find]", unsigned short, unsigned int, unsigned long, 
+    unsigned long long) {
+
+    using num_type = TestType;
+    constexpr auto digits = bit::binary_digits<num_type>::value;
+
+    // 0101...0101 has no pair of equal adjacent bits
+    num_type alternating = static_cast<num_type>(-1) / 3;
+    bit_iterator<num_type*> first(&alternating, 0);
+    bit_iterator<num_type*> last(&alternating + 1, 0);
+    REQUIRE(bit::adjacent_find(first, last) == last);
+    REQUIRE(bit::adjacent_find(first, first + 1) == first + 1);
+
+    num_type num = string_as_bits<num_type>(random_bit_str(digits));
+    first = bit_iterator<num_type*>(&num, 0);
+    last = bit_iterator<num_type*>(&num + 1, 0);
+    REQUIRE(bit::adjacent_find(first, last) == std::adjacent_find(first, last));
+    REQUIRE(bit::adjacent_find(first + 3, last - 2) 
+            == std::adjacent_find(first + 3, last - 2));
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("adjacent_find: is correct across words", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    constexpr auto digits = bit::binary_digits<num_type>::value;
+
+    // Alternating bits with a single equal pair straddling two words
+    container_type cont(4, static_cast<num_type>(
+        static_cast<num_type>(-1) / 3));
+    auto word_it = std::next(cont.begin());
+    *word_it = static_cast<num_type>(~*word_it);
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(
+        std::begin(cont));
+    auto last = bit::bit_iterator<decltype(std::end(cont))>(std::end(cont));
+    REQUIRE(bit::adjacent_find(first, last) == std::next(first, digits - 1));
+    REQUIRE(bit::adjacent_find(first, last) == std::adjacent_find(first, last));
+
+    container_type random = make_random_container<container_type>(4);
+    first = bit::bit_iterator<decltype(std::begin(random))>(
+        std::begin(random));
+    last = bit::bit_iterator<decltype(std::end(random))>(std::end(random));
+    for (std::size_t offset = 0; offset < digits + 3; offset += 5) {
+        auto first_t = std::next(first, offset);
+        auto last_t = std::next(first, 3 * digits - offset / 2);
+        REQUIRE(bit::adjacent_find(first_t, last_t) 
+                == std::adjacent_find(first_t, last_t));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _ADJACENT_FIND_TESTS_HPP_INCLUDED
+// ========================================================================== //
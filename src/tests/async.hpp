@@ -0,0 +1,125 @@
+// ============================== ASYNC TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            async.hpp
+// Description:     Tests for the asynchronous variants of the bit algorithms
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _ASYNC_TESTS_HPP_INCLUDED
+#define _ASYNC_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------ Async Tests ------------------------------- //
+TEMPLATE_TEST_CASE("async: futures hold the results of the algorithms",
+    "[async]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    container_type cont = make_random_container<container_type>(1 << 14);
+    container_type other(cont.size());
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(
+        std::begin(cont));
+    auto last = bit::bit_iterator<decltype(std::end(cont))>(std::end(cont));
+    auto d_first = bit::bit_iterator<decltype(std::begin(other))>(
+        std::begin(other));
+
+    // Sequential and parallel algorithms run concurrently
+    auto count = bit::async::count(first + 3, last, bit::bit1);
+    auto par_count = bit::async::count(bit::execution::par(4), first + 3,
+        last, bit::bit1);
+    auto find = bit::async::find(bit::execution::par(4), first + 5, last,
+        bit::bit0);
+    REQUIRE(count.get() == bit::count(first + 3, last, bit::bit1));
+    REQUIRE(par_count.get() == bit::count(first + 3, last, bit::bit1));
+    REQUIRE(find.get() == bit::find(first + 5, last, bit::bit0));
+
+    // Algorithms writing to a range
+    auto copy = bit::async::copy(bit::execution::par(4), first + 7, last,
+        d_first + 1);
+    REQUIRE(copy.get() == d_first + 1 + bit::distance(first + 7, last));
+    REQUIRE(std::equal(first + 7, last, d_first + 1));
+    auto fill = bit::async::fill(d_first, d_first + 100, bit::bit1);
+    fill.get();
+    REQUIRE(bit::count(d_first, d_first + 100, bit::bit1) == 100);
+}
+
+TEST_CASE("async: pipelines are launched as one task, exceptions propagate",
+    "[async]") {
+
+    using container_type = std::vector<unsigned long long>;
+    container_type cont = make_random_container<container_type>(1 << 12);
+    container_type other(cont.size());
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(
+        std::begin(cont));
+    auto last = bit::bit_iterator<decltype(std::end(cont))>(std::end(cont));
+    auto d_first = bit::bit_iterator<decltype(std::begin(other))>(
+        std::begin(other));
+
+    // Negates the range into another one, and counts the result
+    auto pipeline = bit::async::launch([=]{
+        auto d_last = bit::transform(bit::execution::par(4), first, last,
+            d_first, std::bit_not<>());
+        return bit::count(bit::execution::par(4), d_first, d_last, bit::bit1);
+    });
+    REQUIRE(pipeline.get() == bit::count(first, last, bit::bit0));
+
+    // Errors are rethrown by the future
+    auto failure = bit::async::launch([]() -> int {
+        throw std::runtime_error("failure");
+    });
+    REQUIRE_THROWS_AS(failure.get(), std::runtime_error);
+}
+
+TEST_CASE("async: launched functions run concurrently", "[async]") {
+
+    // More functions than hardware threads wait for all of them to start:
+    // queued behind each other, the first ones would time out
+    const std::size_t tasks = std::thread::hardware_concurrency() + 4;
+    std::mutex mutex;
+    std::condition_variable all_started;
+    std::size_t started = 0;
+    std::vector<std::future<bool>> futures;
+    for (std::size_t i = 0; i < tasks; ++i) {
+        futures.push_back(bit::async::launch([&]{
+            std::unique_lock<std::mutex> lock(mutex);
+            if (++started == tasks) {
+                all_started.notify_all();
+            }
+            return all_started.wait_for(lock, std::chrono::seconds(10),
+                [&]{return started == tasks;});
+        }));
+    }
+    bool overlapped = true;
+    for (std::future<bool>& future: futures) {
+        overlapped &= future.get();
+    }
+    REQUIRE(overlapped);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _ASYNC_TESTS_HPP_INCLUDED
+// ========================================================================== //
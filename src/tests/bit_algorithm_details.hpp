@@ -19,6 +19,77 @@
 // Third-party libraries
 #include "catch2.hpp"
 
+TEMPLATE_TEST_CASE("get_word reads contiguous words as list words",
+    "[get_word]", unsigned char, unsigned short, unsigned int,
+    unsigned long long) {
+    using word_type = TestType;
+    constexpr std::size_t digits = bit::binary_digits<word_type>::value;
+    auto vec = make_random_container<std::vector<word_type>>(3);
+    std::list<word_type> list(vec.begin(), vec.end());
+    auto v_first = bit::bit_iterator<decltype(vec.begin())>(vec.begin());
+    auto l_first = bit::bit_iterator<decltype(list.begin())>(list.begin());
+
+    // Bits within a word and across two words, up to the end of the range
+    for (std::size_t pos = 0; pos <= 2 * digits; ++pos) {
+        const std::size_t max_len = std::min(digits, 3 * digits - pos);
+        for (std::size_t len = 1; len <= max_len; ++len) {
+            const word_type mask = static_cast<word_type>(
+                static_cast<word_type>(~word_type()) >> (digits - len));
+            REQUIRE((bit::get_word<word_type>(v_first + pos, len) & mask)
+                 == (bit::get_word<word_type>(std::next(l_first, pos), len)
+                     & mask));
+        }
+        if (pos + digits <= 3 * digits) {
+            REQUIRE(bit::get_full_word<word_type>(v_first + pos)
+                 == bit::get_full_word<word_type>(std::next(l_first, pos)));
+            REQUIRE(bit::get_full_word<word_type>(v_first + pos)
+                 == bit::get_word<word_type>(std::next(l_first, pos)));
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("_for_each_segment visits each bit of a range once",
+    "[segment]", unsigned char, unsigned short, unsigned long long) {
+    using word_type = TestType;
+    using iterator_type = typename std::list<word_type>::iterator;
+    constexpr std::size_t digits = bit::binary_digits<word_type>::value;
+    std::list<word_type> words(3);
+    auto begin = bit::bit_iterator<iterator_type>(words.begin());
+
+    // Every range of three words, with the words visited in order
+    for (std::size_t i = 0; i <= 3 * digits; ++i) {
+        for (std::size_t j = i; j <= 3 * digits; ++j) {
+            std::vector<word_type> masks(3);
+            std::size_t next = 0;
+            auto index = [&](iterator_type it) {
+                return static_cast<std::size_t>(
+                    std::distance(words.begin(), it));
+            };
+            bit::_for_each_segment(std::next(begin, i), std::next(begin, j),
+                [&](iterator_type it, word_type mask) {
+                    REQUIRE(mask != 0);
+                    REQUIRE(index(it) >= next);
+                    masks[index(it)] |= mask;
+                    next = index(it) + 1;
+                },
+                [&](iterator_type first, iterator_type last) {
+                    REQUIRE(index(first) >= next);
+                    for (; first != last; ++first) {
+                        masks[index(first)] = static_cast<word_type>(
+                            ~word_type());
+                    }
+                    next = index(last);
+                });
+            bool visited = true;
+            for (std::size_t k = 0; k < 3 * digits; ++k) {
+                visited &= static_cast<bool>((masks[k / digits]
+                    >> (k % digits)) & 1) == (k >= i && k < j);
+            }
+            REQUIRE(visited);
+        }
+    }
+}
+
 // ========================================================================== //
 #endif // _ALG_UTILS_TESTS_HPP_INCLUDED
 // ========================================================================== //
@@ -228,6 +228,69 @@ TEMPLATE_PRODUCT_TEST_CASE("Copy: same size not aligned copy correct",
     std::copy(bool_first1_t, bool_last1_t, bool_first2_t);
     REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
 }
+TEMPLATE_TEST_CASE("Copy: parallel copy matches sequential copy", "[copy]",
+  unsigned short, unsigned int, unsigned long, unsigned long long) {
+    using container_type = std::vector<TestType>;
+    constexpr std::size_t container_size = 1 << 15;
+    container_type src = make_random_container<container_type>(container_size);
+    container_type dst = make_random_container<container_type>(container_size);
+    container_type expected = dst;
+    auto first = bit::bit_iterator<decltype(std::begin(src))>(std::begin(src));
+    auto last = bit::bit_iterator<decltype(std::end(src))>(std::end(src));
+    auto d_first = bit::bit_iterator<decltype(std::begin(dst))>(std::begin(dst));
+    auto e_first = bit::bit_iterator<decltype(std::begin(expected))>(
+        std::begin(expected));
+
+    // Misaligned source and destination, partial words at both ends
+    auto d_last = bit::copy(bit::execution::par(4), first + 5, last - 70, 
+                            d_first + 11);
+    bit::copy(first + 5, last - 70, e_first + 11);
+    REQUIRE(d_last == d_first + (bit::distance(first, last) - 75 + 11));
+    REQUIRE(dst == expected);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("Copy: contiguous words of mixed widths",
+                           "[template][product]",
+                           (std::vector),
+                           (unsigned char, unsigned short, unsigned int,
+                            unsigned long long)) {
+    using src_type = TestType;
+    using dst_type = std::vector<unsigned char>;
+    using wide_type = std::vector<unsigned long long>;
+    src_type src = make_random_container<src_type>(1024
+        / sizeof(typename src_type::value_type));
+    dst_type narrow = make_random_container<dst_type>(1024);
+    wide_type wide = make_random_container<wide_type>(128);
+    auto boolsrc = bitcont_to_boolcont(src);
+    auto boolnarrow = bitcont_to_boolcont(narrow);
+    auto boolwide = bitcont_to_boolcont(wide);
+    auto first = bit::bit_iterator<decltype(std::begin(src))>(std::begin(src));
+    auto n_first = bit::bit_iterator<decltype(std::begin(narrow))>(
+        std::begin(narrow));
+    auto w_first = bit::bit_iterator<decltype(std::begin(wide))>(
+        std::begin(wide));
+    const std::ptrdiff_t size = boolsrc.size();
+
+    // Narrow and wide destinations, at byte-aligned and unaligned offsets
+    for (std::ptrdiff_t offset : {0, 3, 8, 16, 61, 64, 127}) {
+        for (std::ptrdiff_t d_offset : {0, 5, 8, 64}) {
+            const std::ptrdiff_t len = size - offset - 67;
+            auto n_last = bit::copy(first + offset, first + offset + len,
+                n_first + d_offset);
+            std::copy(boolsrc.begin() + offset,
+                boolsrc.begin() + offset + len, boolnarrow.begin() + d_offset);
+            REQUIRE(n_last == n_first + d_offset + len);
+            REQUIRE(std::equal(boolnarrow.begin(), boolnarrow.end(), n_first,
+                comparator));
+            bit::copy(n_first + offset, n_first + offset + len,
+                w_first + d_offset);
+            std::copy(boolnarrow.begin() + offset,
+                boolnarrow.begin() + offset + len, boolwide.begin() + d_offset);
+            REQUIRE(std::equal(boolwide.begin(), boolwide.end(), w_first,
+                comparator));
+        }
+    }
+}
 // -------------------------------------------------------------------------- //
 
 
@@ -266,6 +266,28 @@ TEMPLATE_TEST_CASE("Vector: correctly counts number of unset bits where bits all
     REQUIRE(num_bits_unset == expected_bits_unset);
 }
 
+TEMPLATE_TEST_CASE("Vector: parallel count matches sequential count",
+    "[count]", unsigned short, unsigned int, unsigned long, unsigned long long) {
+    using num_type = TestType;
+
+    std::size_t vec_len = random_number<std::size_t>(1 << 14, 1 << 15);
+    std::vector<num_type> nums = make_random_container<std::vector<num_type>>(
+        vec_len);
+
+    auto first = bit::bit_iterator<decltype(nums.begin())>(nums.begin()) + 7;
+    auto last = bit::bit_iterator<decltype(nums.end())>(nums.end()) - 9;
+
+    auto expected_bits_set = std::count(first, last, bit::bit1);
+    auto expected_bits_unset = std::count(first, last, bit::bit0);
+
+    REQUIRE(count(bit::execution::par(4), first, last, bit::bit1) 
+            == expected_bits_set);
+    REQUIRE(count(bit::execution::par, first, last, bit::bit0) 
+            == expected_bits_unset);
+    REQUIRE(count(bit::execution::seq, first, last, bit::bit1) 
+            == expected_bits_set);
+}
+
 // ========================================================================== //
 #endif // _COUNT_TESTS_HPP_INCLUDED
 // ========================================================================== //
@@ -0,0 +1,75 @@
+// =========================== COUNT RANGES TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            count_ranges.hpp
+// Description:     Tests for batched count queries on bit ranges
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _COUNT_RANGES_TESTS_HPP_INCLUDED
+#define _COUNT_RANGES_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <utility>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// -------------------------- Count Ranges Tests ---------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("count_ranges: matches a count per query",
+                           "[template][product]",
+                           (std::vector, std::list, std::forward_list),
+                           (unsigned short, unsigned int,
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    container_type bitcont = make_random_container<container_type>(16);
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(
+        std::begin(bitcont));
+    auto last = bit::bit_iterator<decltype(std::end(bitcont))>(
+        std::end(bitcont));
+    auto bool_first = std::begin(boolcont);
+    const std::ptrdiff_t size = bit::distance(first, last);
+
+    // Random, overlapping, nested, empty, and whole range queries
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> queries;
+    for (std::size_t i = 0; i < 64; ++i) {
+        std::ptrdiff_t start = random_number<std::ptrdiff_t>(0, size);
+        std::ptrdiff_t end = random_number<std::ptrdiff_t>(0, size);
+        queries.emplace_back(std::min(start, end), std::max(start, end));
+    }
+    queries.emplace_back(0, size);
+    queries.emplace_back(size / 2, size / 2);
+    queries.emplace_back(0, 0);
+    queries.emplace_back(size, size);
+    std::vector<std::ptrdiff_t> counts(queries.size());
+    auto d_last = bit::count_ranges(first, last, queries, counts.begin());
+    REQUIRE(d_last == counts.end());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+        REQUIRE(counts[i] == std::count(
+            std::next(bool_first, queries[i].first),
+            std::next(bool_first, queries[i].second), true));
+    }
+
+    // No query
+    queries.clear();
+    REQUIRE(bit::count_ranges(first, last, queries.begin(), queries.end(),
+                              counts.begin()) == counts.begin());
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _COUNT_RANGES_TESTS_HPP_INCLUDED
+// ========================================================================== //
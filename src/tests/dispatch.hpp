@@ -0,0 +1,232 @@
+// ============================= DISPATCH TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            dispatch.hpp
+// Description:     Tests for the runtime selection of the bit kernels
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _DISPATCH_TESTS_HPP_INCLUDED
+#define _DISPATCH_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ----------------------------- Dispatch Tests ----------------------------- //
+TEST_CASE("dispatch: instruction sets are parsed and clamped", "[dispatch]") {
+    using bit::instruction_set;
+    const instruction_set active = bit::active_instruction_set();
+    const instruction_set detected = bit::detected_instruction_set();
+    REQUIRE(active <= detected);
+    REQUIRE(bit::_parse_instruction_set("scalar", detected)
+            == instruction_set::scalar);
+    REQUIRE(bit::_parse_instruction_set("avx2", detected)
+            == instruction_set::avx2);
+    REQUIRE(bit::_parse_instruction_set("sse", detected) == detected);
+    REQUIRE(bit::_parse_instruction_set(nullptr, detected) == detected);
+    REQUIRE(bit::set_instruction_set(instruction_set::avx512) == detected);
+    REQUIRE(bit::set_instruction_set(instruction_set::scalar)
+            == instruction_set::scalar);
+    REQUIRE(bit::active_instruction_set() == instruction_set::scalar);
+    bit::set_instruction_set(active);
+}
+
+TEMPLATE_TEST_CASE("dispatch: every instruction set counts the same bits",
+    "[dispatch]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using bit::instruction_set;
+    using container_type = std::vector<TestType>;
+    container_type cont = make_random_container<container_type>(1000);
+    auto boolcont = bitcont_to_boolcont(cont);
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(
+        std::begin(cont));
+    const std::size_t size = bit::distance(first,
+        bit::bit_iterator<decltype(std::end(cont))>(std::end(cont)));
+
+    // Compares the kernels on ranges of every length modulo the unrolling
+    const instruction_set active = bit::active_instruction_set();
+    const instruction_set sets[] = {instruction_set::scalar,
+                                    instruction_set::bmi2,
+                                    instruction_set::avx2,
+                                    instruction_set::avx512};
+    for (instruction_set isa : sets) {
+        bit::set_instruction_set(isa);
+        for (std::size_t start : {0, 3, 64, 200}) {
+            for (std::size_t end : {size, size - 1, size - 64 * 37 - 5}) {
+                REQUIRE(bit::count(first + start, first + end, bit::bit1)
+                        == std::count(std::begin(boolcont) + start,
+                                      std::begin(boolcont) + end, true));
+            }
+        }
+    }
+    bit::set_instruction_set(active);
+}
+
+TEMPLATE_TEST_CASE("dispatch: every instruction set moves the same bits",
+    "[dispatch]", unsigned long, unsigned long long) {
+
+    using bit::instruction_set;
+    using container_type = std::vector<TestType>;
+    const container_type cont = make_random_container<container_type>(300);
+    const auto boolcont = bitcont_to_boolcont(cont);
+    const std::size_t size = boolcont.size();
+
+    // Copies and shifts by every offset modulo the word size, on lengths
+    // ending in every block of the kernels
+    const instruction_set active = bit::active_instruction_set();
+    const instruction_set sets[] = {instruction_set::scalar,
+                                    instruction_set::avx2,
+                                    instruction_set::avx512};
+    for (instruction_set isa : sets) {
+        bit::set_instruction_set(isa);
+        for (std::size_t start : {0, 1, 63, 64, 130}) {
+            for (std::size_t n : {1, 17, 64, 200, 64 * 9 + 5}) {
+                for (std::size_t end : {size, size - 3, size - 64 * 11}) {
+                    container_type bitcont = cont;
+                    auto first = bit::bit_iterator<
+                        decltype(std::begin(bitcont))>(std::begin(bitcont));
+                    std::vector<bool> expected = boolcont;
+                    auto bool_first = std::begin(expected);
+
+                    // Copy to a lower offset
+                    REQUIRE(bit::copy(first + start + n, first + end,
+                        first + start) == first + (end - n));
+                    std::copy(bool_first + start + n, bool_first + end,
+                        bool_first + start);
+                    REQUIRE(std::equal(bool_first, std::end(expected),
+                        first, comparator));
+
+                    // Shifts in both directions
+                    bit::shift_right(first + start, first + end, n);
+                    std::copy_backward(bool_first + start,
+                        bool_first + end - n, bool_first + end);
+                    std::fill(bool_first + start, bool_first + start + n,
+                        false);
+                    REQUIRE(std::equal(bool_first, std::end(expected),
+                        first, comparator));
+                    bit::shift_left(first + start, first + end, n);
+                    std::copy(bool_first + start + n, bool_first + end,
+                        bool_first + start);
+                    std::fill(bool_first + end - n, bool_first + end, false);
+                    REQUIRE(std::equal(bool_first, std::end(expected),
+                        first, comparator));
+                }
+            }
+        }
+    }
+    bit::set_instruction_set(active);
+}
+
+TEST_CASE("dispatch: every strategy deposits and extracts the same bits",
+    "[dispatch]") {
+
+    // Reference deposit and extract, bit by bit
+    auto pdep = [](std::uint64_t src, std::uint64_t msk) {
+        std::uint64_t dst = 0;
+        for (unsigned i = 0, j = 0; i < 64; ++i) {
+            if (msk >> i & 1) {
+                dst |= (src >> j++ & 1) << i;
+            }
+        }
+        return dst;
+    };
+    auto pext = [](std::uint64_t src, std::uint64_t msk) {
+        std::uint64_t dst = 0;
+        for (unsigned i = 0, j = 0; i < 64; ++i) {
+            if (msk >> i & 1) {
+                dst |= (src >> i & 1) << j++;
+            }
+        }
+        return dst;
+    };
+
+    // Masks of every density, and the strategies of the kernel table
+    const bit::instruction_set active = bit::active_instruction_set();
+    std::vector<std::uint64_t> masks = {0, 1, ~0ull, 1ull << 63,
+                                        0x5555555555555555ull,
+                                        0xff00ff00ff00ff00ull};
+    for (int i = 0; i < 64; ++i) {
+        masks.push_back(random_number<std::uint64_t>()
+                        & random_number<std::uint64_t>()
+                        & (i % 2 ? ~0ull : random_number<std::uint64_t>()));
+        masks.push_back(random_number<std::uint64_t>()
+                        | random_number<std::uint64_t>());
+    }
+    for (bit::instruction_set isa : {bit::instruction_set::scalar,
+                                     bit::instruction_set::bmi2}) {
+        bit::set_instruction_set(isa);
+        for (std::uint64_t msk : masks) {
+            const std::uint64_t src = random_number<std::uint64_t>();
+            REQUIRE(bit::_pdep_loop(src, msk) == pdep(src, msk));
+            REQUIRE(bit::_pext_loop(src, msk) == pext(src, msk));
+            REQUIRE(bit::_pdep_block(src, msk) == pdep(src, msk));
+            REQUIRE(bit::_pext_block(src, msk) == pext(src, msk));
+            REQUIRE(bit::_kernels().pdep(src, msk) == pdep(src, msk));
+            REQUIRE(bit::_kernels().pext(src, msk) == pext(src, msk));
+        }
+    }
+    bit::set_instruction_set(active);
+}
+
+TEST_CASE("dispatch: every instruction set finds the same bits",
+    "[dispatch]") {
+
+    using bit::instruction_set;
+    using container_type = std::vector<unsigned long long>;
+    using iterator_type = bit::bit_iterator<container_type::iterator>;
+    container_type cont(150);
+
+    // Single bits in empty and full bitmaps, before, inside, and after
+    // the blocks of the kernels
+    const instruction_set active = bit::active_instruction_set();
+    const instruction_set sets[] = {instruction_set::scalar,
+                                    instruction_set::avx2,
+                                    instruction_set::avx512};
+    for (instruction_set isa : sets) {
+        bit::set_instruction_set(isa);
+        for (std::size_t start : {0, 5, 64, 1000}) {
+            for (std::size_t pos : {0, 3, 63, 64, 1023, 1024, 2047, 2048,
+                                    5000, 9000, 9599}) {
+                std::fill(cont.begin(), cont.end(), 0);
+                iterator_type first(cont.begin());
+                iterator_type last(cont.end());
+                const iterator_type expected = pos >= start
+                    ? first + pos
+                    : last;
+                first[pos] = bit::bit1;
+                REQUIRE(bit::find(first + start, last, bit::bit1)
+                        == expected);
+                REQUIRE(bit::max_element(first + start, last)
+                        == (pos >= start ? expected : first + start));
+                std::fill(cont.begin(), cont.end(), ~0ull);
+                first[pos] = bit::bit0;
+                REQUIRE(bit::find(first + start, last, bit::bit0)
+                        == expected);
+                REQUIRE(bit::find(first + start, last - 1, bit::bit0)
+                        == (pos >= start && pos < 9599
+                            ? expected
+                            : last - 1));
+            }
+        }
+    }
+    bit::set_instruction_set(active);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _DISPATCH_TESTS_HPP_INCLUDED
+// ========================================================================== //
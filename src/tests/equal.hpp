@@ -0,0 +1,84 @@
+// ============================== EQUAL TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            equal.hpp
+// Description:     Tests for equal
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EQUAL_TESTS_HPP_INCLUDED
+#define _EQUAL_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------ Equal Tests ------------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("equal: same bits in words of any widths",
+                           "[template][product]",
+                           (std::vector, std::list, std::forward_list),
+                           (unsigned char, unsigned short, unsigned int,
+                            unsigned long long)) {
+
+    using container_type = TestType;
+    container_type bitcont = make_random_container<container_type>(64);
+    container_type other = bitcont;
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    const std::ptrdiff_t size = std::distance(std::begin(boolcont),
+        std::end(boolcont));
+    std::vector<unsigned char> bytes(size / 8);
+    auto first = bit::bit_iterator<decltype(std::begin(bitcont))>(
+        std::begin(bitcont));
+    auto o_first = bit::bit_iterator<decltype(std::begin(other))>(
+        std::begin(other));
+    auto b_first = bit::bit_iterator<decltype(std::begin(bytes))>(
+        std::begin(bytes));
+    std::transform(std::begin(boolcont), std::end(boolcont), b_first,
+        [](bool b) { return b ? bit::bit1 : bit::bit0; });
+
+    // Equal ranges, then one flipped bit at the start, middle or end
+    for (std::ptrdiff_t offset : {0, 3, 8, 64}) {
+        for (std::ptrdiff_t len : {std::ptrdiff_t(0), std::ptrdiff_t(5),
+                                   size / 2 + 1, size - offset}) {
+            auto last = std::next(first, offset + len);
+            auto o_last = std::next(o_first, offset + len);
+            REQUIRE(bit::equal(std::next(first, offset), last,
+                std::next(o_first, offset)));
+            REQUIRE(bit::equal(std::next(first, offset), last,
+                b_first + offset));
+            REQUIRE(bit::equal(std::next(first, offset), last,
+                std::next(o_first, offset), o_last));
+            for (std::ptrdiff_t pos : {offset, offset + len / 2,
+                                       offset + len - 1}) {
+                if (len == 0) continue;
+                b_first[pos].flip();
+                (*std::next(o_first, pos)).flip();
+                REQUIRE(!bit::equal(std::next(first, offset), last,
+                    std::next(o_first, offset)));
+                REQUIRE(!bit::equal(std::next(first, offset), last,
+                    b_first + offset));
+                b_first[pos].flip();
+                (*std::next(o_first, pos)).flip();
+            }
+        }
+    }
+    REQUIRE(!bit::equal(first, std::next(first, 9), o_first,
+        std::next(o_first, 8)));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _EQUAL_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,86 @@
+// ========================== EXCLUSIVE SCAN TESTS ========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            exclusive_scan.hpp
+// Description:     Tests for exclusive_scan bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EXCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+#define _EXCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <numeric>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// -------------------------- Exclusive Scan Tests -------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("exclusive_scan: writes the prefix parity", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    auto container_size = 4;
+    auto digits = bit::binary_digits<num_type>::value;
+    container_type bitcont1 = make_random_container<container_type>
+                                     (container_size); 
+    container_type bitcont2 = make_random_container<container_type>
+                                     (container_size); 
+    auto bfirst1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto bfirst2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+
+    for (auto init : {bit::bit0, bit::bit1}) {
+        auto bfirst1_t = std::next(bfirst1, 5);
+        auto blast1_t = std::next(bfirst1, 3 * digits + 2);
+        auto bfirst2_t = std::next(bfirst2, 9);
+        auto bret = bit::exclusive_scan(bfirst1_t, blast1_t, bfirst2_t, init);
+        REQUIRE(bret == std::next(bfirst2_t, 3 * digits - 3));
+        bool expected = static_cast<bool>(init);
+        for (; bfirst1_t != blast1_t; ++bfirst1_t, ++bfirst2_t) {
+            REQUIRE(static_cast<bool>(*bfirst2_t) == expected);
+            expected ^= static_cast<bool>(*bfirst1_t);
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("exclusive_scan: writes integer ranks", "[exclusive_scan]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using num_type = TestType;
+    auto digits = bit::binary_digits<num_type>::value;
+    std::vector<num_type> nums = make_random_container<std::vector<num_type>>(3);
+    bit_iterator<num_type*> first(nums.data(), 1);
+    bit_iterator<num_type*> last(nums.data() + 2, digits - 1);
+
+    std::vector<int> ranks(3 * digits);
+    std::vector<int> expected(3 * digits);
+    auto ret = bit::exclusive_scan(first, last, ranks.begin(), 10);
+    int count = 10;
+    auto expected_it = expected.begin();
+    for (auto it = first; it != last; ++it, ++expected_it) {
+        *expected_it = count;
+        count += static_cast<bool>(*it);
+    }
+    REQUIRE(ret == ranks.begin() + (last - first));
+    REQUIRE(ranks == expected);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _EXCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,114 @@
+// ============================ EXECUTION TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            execution.hpp
+// Description:     Tests for the parallel executor of bit algorithms
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _EXECUTION_TESTS_HPP_INCLUDED
+#define _EXECUTION_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <atomic>
+#include <stdexcept>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ----------------------------- Executor Tests ----------------------------- //
+TEST_CASE("execution: parallel_for runs every task once", "[execution]") {
+    std::vector<std::atomic<int>> calls(1000);
+    bit::_parallel_for(calls.size(), 4, [&](std::size_t i) {++calls[i];});
+    REQUIRE(std::all_of(calls.begin(), calls.end(), 
+                        [](const std::atomic<int>& c) {return c == 1;}));
+    REQUIRE_THROWS_AS(bit::_parallel_for(10, 4, [](std::size_t i) {
+        if (i == 7) {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+    bit::_parallel_for(0, 4, [&](std::size_t i) {++calls[i];});
+    REQUIRE(std::all_of(calls.begin(), calls.end(), 
+                        [](const std::atomic<int>& c) {return c == 1;}));
+}
+
+TEMPLATE_TEST_CASE("execution: partition splits at cache line boundaries", 
+    "[execution]", unsigned short, unsigned int, unsigned long, 
+    unsigned long long) {
+
+    using num_type = TestType;
+    using iterator_type = typename std::vector<num_type>::iterator;
+    constexpr std::size_t words = 1 << 16;
+
+    std::vector<num_type> vec(words);
+    bit_iterator<iterator_type> first(vec.begin(), 3);
+    bit_iterator<iterator_type> last(vec.end() - 1, 5);
+
+    // Inner boundaries start at a cache line and are strictly increasing
+    auto bounds = bit::_partition(first, last, 4);
+    REQUIRE(bounds.size() > 2);
+    REQUIRE(bounds.front() == first);
+    REQUIRE(bounds.back() == last);
+    for (std::size_t i = 1; i + 1 < bounds.size(); ++i) {
+        REQUIRE(bounds[i - 1] < bounds[i]);
+        REQUIRE(bounds[i].position() == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(&*bounds[i].base()) 
+                % bit::_cache_line_size == 0);
+    }
+
+    // Sequential execution, short and non random access ranges are whole
+    REQUIRE(bit::_partition(first, last, 1).size() == 2);
+    REQUIRE(bit::_partition(first, first + 100, 4).size() == 2);
+    std::list<num_type> lst(words);
+    auto lfirst = bit::bit_iterator<decltype(std::begin(lst))>(
+        std::begin(lst));
+    auto llast = bit::bit_iterator<decltype(std::end(lst))>(std::end(lst));
+    REQUIRE(bit::_partition(lfirst, llast, 4).size() == 2);
+}
+
+TEMPLATE_TEST_CASE("execution: parallel reductions match sequential ones", 
+    "[execution]", unsigned short, unsigned int, unsigned long, 
+    unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    container_type random1 = make_random_container<container_type>(1 << 15);
+    container_type random2 = make_random_container<container_type>(1 << 15);
+    auto first1 = bit::bit_iterator<decltype(std::begin(random1))>(
+        std::begin(random1)) + 11;
+    auto last1 = bit::bit_iterator<decltype(std::end(random1))>(
+        std::end(random1)) - 13;
+    auto first2 = bit::bit_iterator<decltype(std::begin(random2))>(
+        std::begin(random2)) + 3;
+
+    const auto expected = bit::reduce(first1, last1);
+    REQUIRE(bit::reduce(bit::execution::par(4), first1, last1) == expected);
+    REQUIRE(bit::reduce(bit::execution::par_unseq, first1, last1, 5) 
+            == expected + 5);
+    REQUIRE(bit::reduce(bit::execution::seq, first1, last1) == expected);
+    REQUIRE(bit::transform_reduce(bit::execution::par(3), first1, last1, 
+                                  first2, 0) 
+            == bit::transform_reduce(first1, last1, first2, 0));
+    REQUIRE(bit::transform_reduce(bit::execution::par(4), first1, last1, 
+                                  first2, 0, std::plus<>(), std::bit_xor<>()) 
+            == bit::transform_reduce(first1, last1, first2, 0, 
+                                     std::plus<>(), std::bit_xor<>()));
+    REQUIRE(bit::transform_reduce(bit::execution::par(4), first1, last1, 0, 
+                                  std::plus<>(), std::bit_not<>()) 
+            == bit::count(first1, last1, bit::bit0));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _EXECUTION_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,90 @@
+// =============================== FILL TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            fill.hpp
+// Description:     Tests for fill and fill_n bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _FILL_TESTS_HPP_INCLUDED
+#define _FILL_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------- Fill Tests ------------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("fill: is correct for partial and multi word ranges", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    constexpr std::size_t digits = bit::binary_digits<num_type>::value;
+
+    container_type bitcont = make_random_container<container_type>(4);
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    auto bfirst = bit::bit_iterator<decltype(std::begin(bitcont))>(
+        std::begin(bitcont));
+    auto bool_first = std::begin(boolcont);
+
+    // Same word, head and tail, aligned ends, whole range
+    const std::size_t ranges[][2] = {{3, 9}, {5, 3 * digits - 2}, 
+                                     {digits, 2 * digits}, {0, 4 * digits}};
+    bit::bit_value value = bit::bit1;
+    for (const auto& range : ranges) {
+        bit::fill(std::next(bfirst, range[0]), std::next(bfirst, range[1]), 
+                  value);
+        std::fill(std::next(bool_first, range[0]), 
+                  std::next(bool_first, range[1]), static_cast<bool>(value));
+        REQUIRE(std::equal(std::begin(boolcont), std::end(boolcont), bfirst, 
+                           comparator));
+        value = ~value;
+    }
+    auto last = bit::fill_n(std::next(bfirst, 7), digits, bit::bit1);
+    std::fill_n(std::next(bool_first, 7), digits, true);
+    REQUIRE(last == std::next(bfirst, digits + 7));
+    REQUIRE(std::equal(std::begin(boolcont), std::end(boolcont), bfirst, 
+                       comparator));
+}
+
+TEMPLATE_TEST_CASE("fill: parallel fill matches sequential fill", "[fill]", 
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    container_type cont = make_random_container<container_type>(1 << 15);
+    container_type expected = cont;
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(
+        std::begin(cont));
+    auto last = bit::bit_iterator<decltype(std::end(cont))>(std::end(cont));
+    auto e_first = bit::bit_iterator<decltype(std::begin(expected))>(
+        std::begin(expected));
+    auto e_last = bit::bit_iterator<decltype(std::end(expected))>(
+        std::end(expected));
+
+    bit::fill(bit::execution::par(4), first + 13, last - 1, bit::bit1);
+    bit::fill(e_first + 13, e_last - 1, bit::bit1);
+    REQUIRE(cont == expected);
+    bit::fill_n(bit::execution::par(4), first + 2, 1 << 18, bit::bit0);
+    bit::fill_n(e_first + 2, 1 << 18, bit::bit0);
+    REQUIRE(cont == expected);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _FILL_TESTS_HPP_INCLUDED
+// ========================================================================== //
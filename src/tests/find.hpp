@@ -75,6 +75,30 @@ TEMPLATE_TEST_CASE("find: is ok for virtual/misaligned words", "[find]",
             std::find(first, last, bit::bit1));
 }
 
+TEMPLATE_TEST_CASE("find: parallel find returns the first match", "[find]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using vec_t = std::vector<TestType>;
+    using vec_iter_t = typename vec_t::iterator;
+    constexpr std::size_t digits = bit::binary_digits<TestType>::value;
+
+    vec_t vec(1 << 15, 0);
+    bit_iterator<vec_iter_t> first(vec.begin(), 3);
+    bit_iterator<vec_iter_t> last(vec.end() - 1, 2);
+
+    // No match, then matches in the last, middle and first chunks
+    REQUIRE(bit::find(bit::execution::par(4), first, last, bit::bit1) == last);
+    for (std::size_t word : {vec.size() - 2, vec.size() / 2, std::size_t(1)}) {
+        vec[word] = 6;
+        REQUIRE(bit::find(bit::execution::par(4), first, last, bit::bit1) 
+                == std::find(first, last, bit::bit1));
+    }
+    REQUIRE(bit::find(bit::execution::par(4), first, last, bit::bit1) 
+            == bit_iterator<vec_iter_t>(vec.begin() + 1, 1));
+    REQUIRE(bit::find(bit::execution::par, first + digits, last, bit::bit0) 
+            == first + digits);
+}
+
 
 
 
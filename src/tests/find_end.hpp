@@ -0,0 +1,92 @@
+// ============================= FIND END TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            find_end.hpp
+// Description:     Tests for find_end bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _FIND_END_TESTS_HPP_INCLUDED
+#define _FIND_END_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ----------------------------- Find End Tests ----------------------------- //
+TEMPLATE_TEST_CASE("find_end: handles empty and oversized patterns", 
+    "[find_end]", unsigned short, unsigned int, unsigned long, 
+    unsigned long long) {
+
+    using num_type = TestType;
+    num_type num = string_as_bits<num_type>(
+        random_bit_str(bit::binary_digits<num_type>::value));
+    bit_iterator<num_type*> first(&num, 0);
+    bit_iterator<num_type*> last(&num + 1, 0);
+    REQUIRE(bit::find_end(first, last, first, first) == last);
+    REQUIRE(bit::find_end(first + 1, first + 3, first, first + 4) 
+            == first + 3);
+    REQUIRE(bit::find_end(first, last, first, last) == first);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("find_end: is correct across words", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    constexpr auto digits = bit::binary_digits<num_type>::value;
+
+    container_type text = make_random_container<container_type>(6);
+    container_type pattern = make_random_container<container_type>(3);
+    auto first = bit::bit_iterator<decltype(std::begin(text))>(
+        std::begin(text));
+    auto last = bit::bit_iterator<decltype(std::end(text))>(std::end(text));
+    auto s_first = bit::bit_iterator<decltype(std::begin(pattern))>(
+        std::begin(pattern));
+
+    // Short patterns that occur many times
+    for (std::size_t len = 1; len < 8; ++len) {
+        auto s_last = std::next(s_first, len);
+        REQUIRE(bit::find_end(first, last, s_first, s_last) 
+                == std::find_end(first, last, s_first, s_last));
+        REQUIRE(bit::find_end(std::next(first, 3), std::next(first, digits), 
+                              s_first, s_last) 
+                == std::find_end(std::next(first, 3), std::next(first, digits), 
+                                 s_first, s_last));
+    }
+
+    // Patterns shorter and longer than a word, taken from the text itself
+    for (std::size_t len : {digits / 2, digits - 1, digits, digits + 5, 
+                            2 * digits + 3}) {
+        auto s_last = std::next(s_first, len);
+        REQUIRE(bit::find_end(first, last, s_first, s_last) 
+                == std::find_end(first, last, s_first, s_last));
+        for (std::size_t offset : {std::size_t(0), std::size_t(5), 
+                                   digits + 1, 3 * digits - 7}) {
+            auto t_first = std::next(first, offset);
+            auto t_last = std::next(t_first, len);
+            REQUIRE(bit::find_end(first, last, t_first, t_last) 
+                    == std::find_end(first, last, t_first, t_last));
+        }
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _FIND_END_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,77 @@
+// ========================== FIND FIRST OF TESTS =========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            find_first_of.hpp
+// Description:     Tests for find_first_of bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _FIND_FIRST_OF_TESTS_HPP_INCLUDED
+#define _FIND_FIRST_OF_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// -------------------------- Find First Of Tests --------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("find_first_of: is correct across words", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    constexpr auto digits = bit::binary_digits<num_type>::value;
+
+    // Sets made of zeros only, ones only, and both
+    container_type zeros(4, num_type(0));
+    container_type ones(4, static_cast<num_type>(-1));
+    container_type text(4, num_type(0));
+    *std::next(text.begin(), 2) = num_type(4);
+    auto z_first = bit::bit_iterator<decltype(std::begin(zeros))>(
+        std::begin(zeros));
+    auto o_first = bit::bit_iterator<decltype(std::begin(ones))>(
+        std::begin(ones));
+    auto first = bit::bit_iterator<decltype(std::begin(text))>(
+        std::begin(text));
+    auto last = bit::bit_iterator<decltype(std::end(text))>(std::end(text));
+    REQUIRE(bit::find_first_of(first, last, o_first, std::next(o_first, 9)) 
+            == std::next(first, 2 * digits + 2));
+    REQUIRE(bit::find_first_of(std::next(first, 2 * digits + 2), last, 
+                               z_first, std::next(z_first, 3)) 
+            == std::next(first, 2 * digits + 3));
+    REQUIRE(bit::find_first_of(std::next(first, 5), last, 
+                               z_first, std::next(z_first, 2 * digits + 1)) 
+            == std::next(first, 5));
+    REQUIRE(bit::find_first_of(first, last, z_first, z_first) == last);
+    REQUIRE(bit::find_first_of(first, first, o_first, std::next(o_first)) 
+            == first);
+
+    // Random sets
+    container_type random = make_random_container<container_type>(4);
+    auto s_first = bit::bit_iterator<decltype(std::begin(random))>(
+        std::begin(random));
+    for (std::size_t len = 1; len < 3 * digits; len += 7) {
+        auto s_last = std::next(s_first, len);
+        REQUIRE(bit::find_first_of(first, last, s_first, s_last) 
+                == std::find_first_of(first, last, s_first, s_last));
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _FIND_FIRST_OF_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -0,0 +1,106 @@
+// ========================== INCLUSIVE SCAN TESTS ========================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            inclusive_scan.hpp
+// Description:     Tests for inclusive_scan bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _INCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+#define _INCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <numeric>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// -------------------------- Inclusive Scan Tests -------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("inclusive_scan: writes the prefix parity", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    auto container_size = 4;
+    auto digits = bit::binary_digits<num_type>::value;
+    container_type bitcont1 = make_random_container<container_type>
+                                     (container_size); 
+    container_type bitcont2 = make_random_container<container_type>
+                                     (container_size); 
+    auto boolcont1 = bitcont_to_boolcont(bitcont1);
+    auto boolcont2 = bitcont_to_boolcont(bitcont2);
+    auto bfirst1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto blast1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto bfirst2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto blast2 = bit::bit_iterator<decltype(std::end(bitcont2))>(std::end(bitcont2));
+    auto bool_first1 = std::begin(boolcont1);
+    auto bool_last1 = std::end(boolcont1);
+    auto bool_first2 = std::begin(boolcont2);
+    auto bool_last2 = std::end(boolcont2);
+    auto parity = [](bool b1, bool b2) {return b1 != b2;};
+
+    auto bret = bit::inclusive_scan(bfirst1, blast1, bfirst2);
+    std::partial_sum(bool_first1, bool_last1, bool_first2, parity);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == blast2);
+
+    auto bfirst1_t = std::next(bfirst1, 7);
+    auto blast1_t = std::next(bfirst1, 3 * digits - 1);
+    auto bfirst2_t = std::next(bfirst2, 2);
+    auto bool_first1_t = std::next(bool_first1, 7);
+    auto bool_last1_t = std::next(bool_first1, 3 * digits - 1);
+    auto bool_first2_t = std::next(bool_first2, 2);
+    bret = bit::inclusive_scan(bfirst1_t, blast1_t, bfirst2_t);
+    std::partial_sum(bool_first1_t, bool_last1_t, bool_first2_t, parity);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == std::next(bfirst2_t, 3 * digits - 8));
+
+    // partial_sum is the same scan
+    std::fill(bool_first2, bool_last2, false);
+    std::fill(bfirst2, blast2, bit::bit0);
+    bret = bit::partial_sum(bfirst1_t, blast1_t, bfirst2_t);
+    std::partial_sum(bool_first1_t, bool_last1_t, bool_first2_t, parity);
+    REQUIRE(std::equal(bool_first2, bool_last2, bfirst2, blast2, comparator));
+    REQUIRE(bret == std::next(bfirst2_t, 3 * digits - 8));
+}
+
+TEMPLATE_TEST_CASE("inclusive_scan: writes integer ranks", "[inclusive_scan]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using num_type = TestType;
+    auto digits = bit::binary_digits<num_type>::value;
+    std::vector<num_type> nums = make_random_container<std::vector<num_type>>(5);
+    bit_iterator<num_type*> first(nums.data(), 3);
+    bit_iterator<num_type*> last(nums.data() + 4, 1);
+
+    std::vector<std::size_t> ranks(4 * digits);
+    std::vector<std::size_t> expected(4 * digits);
+    auto ret = bit::inclusive_scan(first, last, ranks.begin());
+    std::size_t count = 0;
+    auto expected_it = expected.begin();
+    for (auto it = first; it != last; ++it, ++expected_it) {
+        count += static_cast<bool>(*it);
+        *expected_it = count;
+    }
+    REQUIRE(ret == ranks.begin() + (last - first));
+    REQUIRE(ranks == expected);
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _INCLUSIVE_SCAN_TESTS_HPP_INCLUDED
+// ========================================================================== //
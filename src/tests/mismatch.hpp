@@ -85,6 +85,43 @@ TEMPLATE_TEST_CASE("Misaligned vector works", "[mismatch]",
     REQUIRE(*(res.second.base()) == 3116);
 }
 
+TEMPLATE_PRODUCT_TEST_CASE("Finds the first mismatch in words of any widths",
+    "[mismatch]", (std::vector, std::list, std::forward_list),
+    (unsigned char, unsigned short, unsigned int, unsigned long long)) {
+
+    using container_type = TestType;
+    container_type bitcont = make_random_container<container_type>(1024);
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    const std::ptrdiff_t size = std::distance(std::begin(boolcont),
+        std::end(boolcont));
+    std::vector<unsigned char> bytes(size / 8);
+    auto first = bit_iterator<decltype(std::begin(bitcont))>(
+        std::begin(bitcont));
+    auto last = bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    auto b_first = bit_iterator<decltype(std::begin(bytes))>(
+        std::begin(bytes));
+    auto b_last = bit_iterator<decltype(std::end(bytes))>(std::end(bytes));
+    std::transform(std::begin(boolcont), std::end(boolcont), b_first,
+        [](bool b) { return b ? bit::bit1 : bit::bit0; });
+
+    // Mismatches in blocks skipped at once or not, and none at all
+    for (std::ptrdiff_t offset : {0, 8, 13}) {
+        for (std::ptrdiff_t pos : {offset, offset + 70, offset + 2048 + 9,
+                                   size - 1}) {
+            b_first[pos].flip();
+            auto p = bit::mismatch(std::next(first, offset), last,
+                b_first + offset, b_last);
+            REQUIRE(bit::distance(first, p.first) == pos);
+            REQUIRE(bit::distance(b_first, p.second) == pos);
+            b_first[pos].flip();
+        }
+        auto p = bit::mismatch(std::next(first, offset), last,
+            b_first + offset, b_last - 3);
+        REQUIRE(bit::distance(first, p.first) == size - 3);
+        REQUIRE(p.second == b_last - 3);
+    }
+}
+
 // ========================================================================== //
 #endif // _MISMATCH_TESTS_HPP_INCLUDED
 // ========================================================================== //
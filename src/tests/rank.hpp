@@ -0,0 +1,106 @@
+// =============================== RANK TESTS =============================== //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            rank.hpp
+// Description:     Tests for the rank directory of bit ranges
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _RANK_TESTS_HPP_INCLUDED
+#define _RANK_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------------- Rank Tests ------------------------------- //
+TEMPLATE_TEST_CASE("rank: answers queries on small ranges", "[rank]", 
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    using iterator_type = typename container_type::iterator;
+    container_type cont = make_random_container<container_type>(100);
+    auto first = bit::bit_iterator<iterator_type>(std::begin(cont)) + 5;
+    auto last = bit::bit_iterator<iterator_type>(std::end(cont)) - 3;
+
+    bit::rank_directory<iterator_type> directory(first, last);
+    REQUIRE(directory.size() == static_cast<std::size_t>(
+        bit::distance(first, last)));
+    for (std::size_t pos = 0; pos <= directory.size(); pos += 7) {
+        REQUIRE(directory.rank(pos) == static_cast<std::size_t>(
+            std::count(first, first + pos, bit::bit1)));
+    }
+    REQUIRE(directory.count() == static_cast<std::size_t>(
+        std::count(first, last, bit::bit1)));
+
+    bit::rank_directory<iterator_type> empty(first, first);
+    REQUIRE(empty.rank(0) == 0);
+    REQUIRE(empty.count() == 0);
+    REQUIRE(empty.select(0) == 0);
+}
+
+TEMPLATE_TEST_CASE("rank: select inverts rank on every instruction set",
+    "[rank]", unsigned short, unsigned int, unsigned long,
+    unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    using iterator_type = typename container_type::iterator;
+    container_type cont = make_random_container<container_type>(1 << 10);
+    auto first = bit::bit_iterator<iterator_type>(std::begin(cont)) + 3;
+    auto last = bit::bit_iterator<iterator_type>(std::end(cont)) - 2;
+
+    // The set bit of rank k is the k-th one encountered from the start
+    const bit::instruction_set active = bit::active_instruction_set();
+    for (bit::instruction_set isa : {bit::instruction_set::scalar,
+                                     bit::instruction_set::bmi2}) {
+        bit::set_instruction_set(isa);
+        bit::rank_directory<iterator_type> directory(first, last);
+        std::size_t k = 0;
+        for (auto it = first; it != last; ++it) {
+            if (*it == bit::bit1) {
+                REQUIRE(directory.select(k) == static_cast<std::size_t>(
+                    bit::distance(first, it)));
+                REQUIRE(directory.rank(directory.select(k)) == k);
+                ++k;
+            }
+        }
+        REQUIRE(directory.select(k) == directory.size());
+    }
+    bit::set_instruction_set(active);
+}
+
+TEMPLATE_TEST_CASE("rank: parallel build matches sequential build", "[rank]", 
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    using iterator_type = typename container_type::iterator;
+    container_type cont = make_random_container<container_type>(1 << 15);
+    auto first = bit::bit_iterator<iterator_type>(std::begin(cont)) + 1;
+    auto last = bit::bit_iterator<iterator_type>(std::end(cont)) - 1;
+
+    bit::rank_directory<iterator_type> sequential(first, last);
+    bit::rank_directory<iterator_type> parallel(
+        bit::execution::par(4), first, last);
+    for (std::size_t pos = 0; pos <= sequential.size(); pos += 997) {
+        REQUIRE(parallel.rank(pos) == sequential.rank(pos));
+    }
+    REQUIRE(parallel.count() == static_cast<std::size_t>(
+        bit::count(first, last, bit::bit1)));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _RANK_TESTS_HPP_INCLUDED
+// ========================================================================== //
@@ -107,6 +107,30 @@ TEMPLATE_PRODUCT_TEST_CASE("replace: handles multi word cases",
     REQUIRE(*std::next(word_iter, 2) == 0);
 }
 
+TEMPLATE_TEST_CASE("replace: parallel replace matches sequential replace", 
+  "[replace]", unsigned short, unsigned int, unsigned long, unsigned long long) {
+    using container_type = std::vector<TestType>;
+    container_type cont = make_random_container<container_type>(1 << 15);
+    container_type expected = cont;
+    auto first = bit::bit_iterator<decltype(std::begin(cont))>(std::begin(cont));
+    auto last = bit::bit_iterator<decltype(std::end(cont))>(std::end(cont));
+    auto e_first = bit::bit_iterator<decltype(std::begin(expected))>(
+        std::begin(expected));
+    auto e_last = bit::bit_iterator<decltype(std::end(expected))>(
+        std::end(expected));
+
+    bit::replace(bit::execution::par(4), first + 3, last - 9, 
+                 bit::bit0, bit::bit1);
+    std::replace(e_first + 3, e_last - 9, bit::bit0, bit::bit1);
+    REQUIRE(cont == expected);
+    bit::replace(bit::execution::par(4), first + 1, last, 
+                 bit::bit1, bit::bit0);
+    std::replace(e_first + 1, e_last, bit::bit1, bit::bit0);
+    REQUIRE(cont == expected);
+    bit::replace(bit::execution::par(4), first, last, bit::bit0, bit::bit0);
+    REQUIRE(cont == expected);
+}
+
 // -------------------------------------------------------------------------- //
 
 
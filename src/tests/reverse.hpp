@@ -119,3 +119,57 @@ TEMPLATE_PRODUCT_TEST_CASE("Vector: full reverse correct",
     std::reverse(bool_first, bool_last);
     REQUIRE(std::equal(bool_first, bool_last, bfirst, blast, comparator));
 }
+
+TEMPLATE_TEST_CASE("Vector: parallel reverse correct", "[reverse]", 
+  unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    auto container_size = 1 << 15;
+    container_type bitcont = make_random_container<container_type>
+                                     (container_size);
+    auto bfirst = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto blast = bit::bit_iterator<decltype(std::end(bitcont))>(std::end(bitcont));
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    auto bool_first = std::begin(boolcont);
+    auto bool_last = std::end(boolcont);
+
+    // Aligned, misaligned with an even and with an odd number of bits
+    reverse(bit::execution::par(4), bfirst, blast); 
+    std::reverse(bool_first, bool_last);
+    REQUIRE(std::equal(bool_first, bool_last, bfirst, blast, comparator));
+    reverse(bit::execution::par(4), bfirst + 5, blast - 11); 
+    std::reverse(bool_first + 5, bool_last - 11);
+    REQUIRE(std::equal(bool_first, bool_last, bfirst, blast, comparator));
+    reverse(bit::execution::par(3), bfirst + 3, blast - 2); 
+    std::reverse(bool_first + 3, bool_last - 2);
+    REQUIRE(std::equal(bool_first, bool_last, bfirst, blast, comparator));
+}
+
+TEMPLATE_TEST_CASE("Vector: single pass reverse correct for every kernel", 
+  "[reverse]", unsigned short, unsigned int, unsigned long, 
+  unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    constexpr std::size_t digits = bit::binary_digits<TestType>::value;
+    container_type bitcont = make_random_container<container_type>(64);
+    auto bfirst = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto boolcont = bitcont_to_boolcont(bitcont);
+    auto bool_first = std::begin(boolcont);
+
+    // Every shift of the realignment, with ranges ending in and across words
+    const bit::instruction_set active = bit::active_instruction_set();
+    for (bit::instruction_set isa : {bit::instruction_set::scalar, 
+                                     bit::instruction_set::avx2}) {
+        bit::set_instruction_set(isa);
+        for (std::size_t start = 0; start < digits; start += 3) {
+            for (std::size_t len : {digits - start, 2 * digits + 1, 
+                                    37 * digits + start, 61 * digits}) {
+                reverse(bfirst + start, bfirst + start + len); 
+                std::reverse(bool_first + start, bool_first + start + len);
+                REQUIRE(std::equal(std::begin(boolcont), std::end(boolcont), 
+                                   bfirst, comparator));
+            }
+        }
+    }
+    bit::set_instruction_set(active);
+}
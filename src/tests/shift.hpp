@@ -163,7 +163,8 @@ TEMPLATE_PRODUCT_TEST_CASE("Shift: right_shift",
 
     std::advance(bfirst1_t, digits+1);
     std::advance(bool_first1_t, digits+1);
-    bit::shift_right(bfirst1_t, blast1_t, digits+7);
+    REQUIRE(bit::shift_right(bfirst1_t, blast1_t, digits+7)
+            == std::next(bfirst1_t, digits+7));
     bit::word_shift_right(bool_first1_t, bool_last1_t, digits+7);
     REQUIRE(std::equal(bool_first1, bool_last1, bfirst1, blast1, comparator));
 
@@ -171,7 +172,8 @@ TEMPLATE_PRODUCT_TEST_CASE("Shift: right_shift",
     std::advance(bool_last1_t, (container_size-1)*digits-digits/2);
     blast1_t = bfirst1;
     std::advance(blast1_t, (container_size-1)*digits-digits/2);
-    bit::shift_right(bfirst1_t, blast1_t, digits);
+    REQUIRE(bit::shift_right(bfirst1_t, blast1_t, digits)
+            == std::next(bfirst1_t, digits));
     bit::word_shift_right(bool_first1_t, bool_last1_t, digits);
     REQUIRE(std::equal(bool_first1, bool_last1, bfirst1, blast1, comparator));
 
@@ -246,6 +248,54 @@ TEMPLATE_PRODUCT_TEST_CASE("Shift: right_shift- single word",
     bit::word_shift_right(bool_first1_t, bool_last1_t, digits-6);
     REQUIRE(std::equal(bool_first1, bool_last1, bfirst1, blast1, comparator));
 }
+
+TEMPLATE_TEST_CASE("Shift: parallel shifts match sequential shifts", "[shift]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    auto container_size = 1 << 15;
+    auto digits = bit::binary_digits<TestType>::value;
+    container_type bitcont1 = make_random_container<container_type>
+                                     (container_size); 
+    container_type bitcont2 = bitcont1;
+    auto bfirst1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto blast1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto bfirst2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto blast2 = bit::bit_iterator<decltype(std::end(bitcont2))>(std::end(bitcont2));
+
+    // Shifts shorter and longer than a chunk, aligned or not
+    for (std::ptrdiff_t n : {std::ptrdiff_t(3), std::ptrdiff_t(digits), 
+                             std::ptrdiff_t(1000), std::ptrdiff_t(100000), 
+                             std::ptrdiff_t(digits * container_size / 2 + 7)}) {
+        REQUIRE(bit::shift_left(bit::execution::par(4), bfirst1 + 5, 
+                                blast1 - 3, n)
+                == bit::shift_left(bfirst2 + 5, blast2 - 3, n) 
+                   - bfirst2 + bfirst1);
+        REQUIRE(bitcont1 == bitcont2);
+        REQUIRE(bit::shift_right(bit::execution::par(4), bfirst1 + 2, 
+                                 blast1 - 9, n)
+                == bit::shift_right(bfirst2 + 2, blast2 - 9, n) 
+                   - bfirst2 + bfirst1);
+        REQUIRE(bitcont1 == bitcont2);
+    }
+
+    // Shifts longer than the last chunk and shorter than the others
+    auto bounds = bit::_partition(bfirst1 + 5, blast1, 4);
+    const auto cut = bounds[bounds.size() - 2] + 10;
+    bounds = bit::_partition(bfirst1 + 5, cut, 4);
+    const std::ptrdiff_t tail = bit::distance(bounds[bounds.size() - 2], cut);
+    const std::ptrdiff_t n = tail + 7;
+    REQUIRE(bounds.size() > 2);
+    REQUIRE(n < bit::distance(bounds[bounds.size() - 3], 
+                              bounds[bounds.size() - 2]));
+    const auto cut2 = cut - bfirst1 + bfirst2;
+    REQUIRE(bit::shift_left(bit::execution::par(4), bfirst1 + 5, cut, n)
+            == bit::shift_left(bfirst2 + 5, cut2, n) - bfirst2 + bfirst1);
+    REQUIRE(bitcont1 == bitcont2);
+    REQUIRE(bit::shift_right(bit::execution::par(4), bfirst1 + 5, cut, n)
+            == bit::shift_right(bfirst2 + 5, cut2, n) - bfirst2 + bfirst1);
+    REQUIRE(bitcont1 == bitcont2);
+}
 // -------------------------------------------------------------------------- //
 
 
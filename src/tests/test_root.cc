@@ -40,5 +40,20 @@
 #include "max_element.hpp"
 #include "padded_read.hpp"
 #include "replace.hpp"
+#include "adjacent_find.hpp"
+#include "adjacent_difference.hpp"
+#include "inclusive_scan.hpp"
+#include "exclusive_scan.hpp"
+#include "transform_reduce.hpp"
+#include "find_end.hpp"
+#include "find_first_of.hpp"
+#include "execution.hpp"
+#include "fill.hpp"
+#include "rank.hpp"
+#include "transform.hpp"
+#include "async.hpp"
+#include "count_ranges.hpp"
+#include "dispatch.hpp"
+#include "wide_word.hpp"
 // Third party libraries
 // ========================================================================== //
@@ -0,0 +1,152 @@
+// ============================ TRANSFORM TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            transform.hpp
+// Description:     Tests for transform bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TRANSFORM_TESTS_HPP_INCLUDED
+#define _TRANSFORM_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ---------------------------- Transform Tests ----------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("transform: word and bit operations match std",
+                           "[template][product]",
+                           (std::vector, std::list),
+                           (unsigned short, unsigned int,
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    constexpr std::size_t digits = bit::binary_digits<num_type>::value;
+    constexpr std::size_t size = 8;
+
+    container_type bitcont1 = make_random_container<container_type>(size);
+    container_type bitcont2 = make_random_container<container_type>(size);
+    container_type bitcont3 = make_random_container<container_type>(size);
+    auto boolcont1 = bitcont_to_boolcont(bitcont1);
+    auto boolcont2 = bitcont_to_boolcont(bitcont2);
+    auto boolcont3 = bitcont_to_boolcont(bitcont3);
+    auto first1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(
+        std::begin(bitcont1));
+    auto first2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(
+        std::begin(bitcont2));
+    auto d_first = bit::bit_iterator<decltype(std::begin(bitcont3))>(
+        std::begin(bitcont3));
+    auto bool_first1 = std::begin(boolcont1);
+    auto bool_first2 = std::begin(boolcont2);
+    auto bool_d_first = std::begin(boolcont3);
+
+    // Offsets of the inputs and of the output, and lengths
+    const std::size_t ranges[][4] = {{0, 0, 0, size * digits},
+                                     {3, 5, 7, 9},
+                                     {1, digits - 1, 2, 4 * digits + 3},
+                                     {digits + 5, 3, digits, 5 * digits}};
+    for (const auto& range : ranges) {
+        auto last = bit::transform(std::next(first1, range[0]),
+            std::next(first1, range[0] + range[3]),
+            std::next(d_first, range[2]), std::bit_not<>());
+        std::transform(std::next(bool_first1, range[0]),
+            std::next(bool_first1, range[0] + range[3]),
+            std::next(bool_d_first, range[2]), std::logical_not<>());
+        REQUIRE(last == std::next(d_first, range[2] + range[3]));
+        REQUIRE(std::equal(std::begin(boolcont3), std::end(boolcont3),
+                           d_first, comparator));
+        last = bit::transform(std::next(first1, range[0]),
+            std::next(first1, range[0] + range[3]),
+            std::next(first2, range[1]), std::next(d_first, range[2]),
+            std::bit_xor<>());
+        std::transform(std::next(bool_first1, range[0]),
+            std::next(bool_first1, range[0] + range[3]),
+            std::next(bool_first2, range[1]),
+            std::next(bool_d_first, range[2]), std::not_equal_to<>());
+        REQUIRE(last == std::next(d_first, range[2] + range[3]));
+        REQUIRE(std::equal(std::begin(boolcont3), std::end(boolcont3),
+                           d_first, comparator));
+        bit::transform(std::next(first1, range[0]),
+            std::next(first1, range[0] + range[3]),
+            std::next(first2, range[1]), std::next(d_first, range[2]),
+            std::equal_to<>());
+        std::transform(std::next(bool_first1, range[0]),
+            std::next(bool_first1, range[0] + range[3]),
+            std::next(bool_first2, range[1]),
+            std::next(bool_d_first, range[2]), std::equal_to<>());
+        REQUIRE(std::equal(std::begin(boolcont3), std::end(boolcont3),
+                           d_first, comparator));
+        bit::transform(std::next(first1, range[0]),
+            std::next(first1, range[0] + range[3]),
+            std::next(first2, range[1]), std::next(d_first, range[2]),
+            [](bit::bit_value a, bit::bit_value b) {return a & ~b;});
+        std::transform(std::next(bool_first1, range[0]),
+            std::next(bool_first1, range[0] + range[3]),
+            std::next(bool_first2, range[1]),
+            std::next(bool_d_first, range[2]),
+            [](bool a, bool b) {return a && !b;});
+        REQUIRE(std::equal(std::begin(boolcont3), std::end(boolcont3),
+                           d_first, comparator));
+    }
+}
+
+TEMPLATE_TEST_CASE("transform: parallel transform matches sequential transform",
+    "[transform]",
+    unsigned short, unsigned int, unsigned long, unsigned long long) {
+
+    using container_type = std::vector<TestType>;
+    container_type cont1 = make_random_container<container_type>(1 << 15);
+    container_type cont2 = make_random_container<container_type>(1 << 15);
+    container_type cont3 = make_random_container<container_type>(1 << 15);
+    container_type expected = cont3;
+    auto first1 = bit::bit_iterator<decltype(std::begin(cont1))>(
+        std::begin(cont1));
+    auto last1 = bit::bit_iterator<decltype(std::end(cont1))>(std::end(cont1));
+    auto first2 = bit::bit_iterator<decltype(std::begin(cont2))>(
+        std::begin(cont2));
+    auto d_first = bit::bit_iterator<decltype(std::begin(cont3))>(
+        std::begin(cont3));
+    auto e_first = bit::bit_iterator<decltype(std::begin(expected))>(
+        std::begin(expected));
+
+    // Regular stores, then non-temporal stores of every output
+    const std::size_t threshold = bit::_non_temporal_threshold();
+    for (std::size_t streaming_threshold : {threshold, std::size_t(0)}) {
+        bit::_non_temporal_threshold() = streaming_threshold;
+        auto last = bit::transform(bit::execution::par(4), first1 + 5,
+            last1 - 9, first2 + 9, d_first + 3, std::bit_and<>());
+        bit::transform(first1 + 5, last1 - 9, first2 + 9, e_first + 3,
+            std::bit_and<>());
+        REQUIRE(last == d_first + 3 + bit::distance(first1 + 5, last1 - 9));
+        REQUIRE(cont3 == expected);
+        bit::transform(bit::execution::par(4), first1, last1 - 70, first2 + 7,
+            d_first + 70, std::bit_or<>());
+        bit::transform(first1, last1 - 70, first2 + 7, e_first + 70,
+            std::bit_or<>());
+        REQUIRE(cont3 == expected);
+        last = bit::transform(bit::execution::par(4), first1 + 1, last1,
+            d_first, std::bit_not<>());
+        bit::transform(first1 + 1, last1, e_first, std::bit_not<>());
+        REQUIRE(last == d_first + bit::distance(first1 + 1, last1));
+        REQUIRE(cont3 == expected);
+    }
+    bit::_non_temporal_threshold() = threshold;
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _TRANSFORM_TESTS_HPP_INCLUDED
+// ========================================================================== //
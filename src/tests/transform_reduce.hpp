@@ -0,0 +1,118 @@
+// ======================== TRANSFORM REDUCE TESTS ========================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            transform_reduce.hpp
+// Description:     Tests for reduce, accumulate, inner_product and 
+//                  transform_reduce bit iterator overloads
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _TRANSFORM_REDUCE_TESTS_HPP_INCLUDED
+#define _TRANSFORM_REDUCE_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <numeric>
+#include <functional>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ------------------------- Transform Reduce Tests ------------------------- //
+TEMPLATE_PRODUCT_TEST_CASE("reduce, accumulate: sum is the popcount", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    auto digits = bit::binary_digits<num_type>::value;
+    container_type bitcont = make_random_container<container_type>(4);
+    auto bfirst = bit::bit_iterator<decltype(std::begin(bitcont))>(std::begin(bitcont));
+    auto bfirst_t = std::next(bfirst, 3);
+    auto blast_t = std::next(bfirst, 3 * digits + 5);
+    auto expected = std::count(bfirst_t, blast_t, bit::bit1);
+
+    REQUIRE(bit::reduce(bfirst_t, blast_t) == expected);
+    REQUIRE(bit::reduce(bfirst_t, blast_t, 7) == expected + 7);
+    REQUIRE(bit::reduce(bfirst_t, blast_t, 7, std::plus<>()) == expected + 7);
+    REQUIRE(bit::accumulate(bfirst_t, blast_t, 7) == expected + 7);
+    REQUIRE(bit::accumulate(bfirst_t, blast_t, 7, std::plus<int>()) 
+            == expected + 7);
+    auto minus = [](int i, auto b) {return i - static_cast<bool>(b);};
+    REQUIRE(bit::accumulate(bfirst_t, blast_t, 7, minus) == 7 - expected);
+}
+
+TEMPLATE_PRODUCT_TEST_CASE("inner_product, transform_reduce: fused popcounts", 
+                           "[template][product]", 
+                           (std::vector, std::list, std::forward_list), 
+                           (unsigned short, unsigned int, 
+                            unsigned long, unsigned long long)) {
+
+    using container_type = TestType;
+    using num_type = typename container_type::value_type;
+    auto digits = bit::binary_digits<num_type>::value;
+    container_type bitcont1 = make_random_container<container_type>(4);
+    container_type bitcont2 = make_random_container<container_type>(4);
+    auto bfirst1 = bit::bit_iterator<decltype(std::begin(bitcont1))>(std::begin(bitcont1));
+    auto blast1 = bit::bit_iterator<decltype(std::end(bitcont1))>(std::end(bitcont1));
+    auto bfirst2 = bit::bit_iterator<decltype(std::begin(bitcont2))>(std::begin(bitcont2));
+    auto bit_and = [](auto b1, auto b2) {
+        return static_cast<bool>(b1) && static_cast<bool>(b2);
+    };
+    auto bit_or = [](auto b1, auto b2) {
+        return static_cast<bool>(b1) || static_cast<bool>(b2);
+    };
+    auto bit_xor = [](auto b1, auto b2) {
+        return static_cast<bool>(b1) != static_cast<bool>(b2);
+    };
+    auto bit_eq = [](auto b1, auto b2) {
+        return static_cast<bool>(b1) == static_cast<bool>(b2);
+    };
+    auto sum = [](int i, bool b) {return i + b;};
+
+    // Aligned and misaligned ranges
+    std::vector<std::pair<std::size_t, std::size_t>> offsets = {
+        {0, 0}, {3, 3}, {5, 1}, {0, 7}
+    };
+    for (auto offset : offsets) {
+        auto first1 = std::next(bfirst1, offset.first);
+        auto last1 = std::next(bfirst1, 3 * digits + offset.first / 2);
+        if (offset.first == 0 && offset.second == 0) {
+            last1 = blast1;
+        }
+        auto first2 = std::next(bfirst2, offset.second);
+        REQUIRE(bit::inner_product(first1, last1, first2, 1)
+                == std::inner_product(first1, last1, first2, 1, sum, bit_and));
+        REQUIRE(bit::transform_reduce(first1, last1, first2, 1)
+                == std::inner_product(first1, last1, first2, 1, sum, bit_and));
+        REQUIRE(bit::inner_product(first1, last1, first2, 1, 
+                    std::plus<>(), std::bit_or<>())
+                == std::inner_product(first1, last1, first2, 1, sum, bit_or));
+        REQUIRE(bit::transform_reduce(first1, last1, first2, 1, 
+                    std::plus<>(), std::bit_xor<>())
+                == std::inner_product(first1, last1, first2, 1, sum, bit_xor));
+        REQUIRE(bit::transform_reduce(first1, last1, first2, 1, 
+                    std::plus<>(), std::equal_to<>())
+                == std::inner_product(first1, last1, first2, 1, sum, bit_eq));
+    }
+    REQUIRE(bit::transform_reduce(bfirst1, blast1, 0, std::plus<>(), 
+                std::logical_not<>())
+            == std::count(bfirst1, blast1, bit::bit0));
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _TRANSFORM_REDUCE_TESTS_HPP_INCLUDED
+// ========================================================================== //
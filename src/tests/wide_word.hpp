@@ -0,0 +1,140 @@
+// ============================ WIDE WORD TESTS ============================= //
+// Project:         The Experimental Bit Algorithms Library
+// Name:            wide_word.hpp
+// Description:     Tests for bit algorithms on 128-bit and simd words
+// Creator:         Vincent Reverdy
+// Contributor(s):  Vincent Reverdy [2019]
+// License:         BSD 3-Clause License
+// ========================================================================== //
+#ifndef _WIDE_WORD_TESTS_HPP_INCLUDED
+#define _WIDE_WORD_TESTS_HPP_INCLUDED
+// ========================================================================== //
+
+
+
+// =============================== PREAMBLE ================================= //
+// C++ standard library
+#include <functional>
+#include <random>
+// Project sources
+#include "test_root.cc"
+#include "bit.hpp"
+// Third-party libraries
+// Miscellaneous
+// ========================================================================== //
+
+
+
+// ---------------------------- Wide Word Tests ----------------------------- //
+TEST_CASE("wide_word: simd words compute as unsigned integers",
+    "[wide_word]") {
+
+    using word_type = bit::simd_word<128>;
+    std::mt19937_64 engine(std::random_device{}());
+    auto to_word = [](__uint128_t x) {
+        word_type word;
+        word.limb(0) = static_cast<std::uint64_t>(x);
+        word.limb(1) = static_cast<std::uint64_t>(x >> 64);
+        return word;
+    };
+
+    // Operations on random values, and shifts of every count
+    for (int i = 0; i < 256; ++i) {
+        const __uint128_t x = (__uint128_t(engine()) << 64) | engine();
+        const __uint128_t y = i % 2 ? (__uint128_t(engine()) << 64) | engine()
+                                    : engine() % 3;
+        const unsigned n = i % 128;
+        REQUIRE(to_word(x + y) == to_word(x) + to_word(y));
+        REQUIRE(to_word(x - y) == to_word(x) - to_word(y));
+        REQUIRE(to_word(x * y) == to_word(x) * to_word(y));
+        REQUIRE(to_word(x ^ ~y) == (to_word(x) ^ ~to_word(y)));
+        REQUIRE(to_word(x << n) == to_word(x) << n);
+        REQUIRE(to_word(x >> n) == to_word(x) >> to_word(n));
+        REQUIRE((x < y) == (to_word(x) < to_word(y)));
+        REQUIRE(bit::_popcnt(to_word(x)) == bit::_popcnt(x));
+        REQUIRE(bit::_tzcnt(to_word(x << n)) == bit::_tzcnt(x << n));
+        REQUIRE(bit::_lzcnt(to_word(x >> n)) == bit::_lzcnt(x >> n));
+    }
+    REQUIRE(word_type(-1) == ~word_type());
+    REQUIRE(word_type(1) << 128 == word_type());
+    REQUIRE(bit::_tzcnt(word_type()) == 128);
+    REQUIRE(bit::_bitswap<word_type>(word_type(1)) == word_type(1) << 127);
+}
+
+TEMPLATE_TEST_CASE("wide_word: algorithms match on wide words",
+    "[wide_word]", __uint128_t, bit::simd_word<128>, bit::simd_word<256>,
+    bit::simd_word<512>) {
+
+    using container_type = std::vector<TestType>;
+    using iterator_type = bit::bit_iterator<typename container_type::iterator>;
+    constexpr std::size_t digits = bit::binary_digits<TestType>::value;
+    constexpr std::size_t words = 2048 / digits + 3;
+    std::mt19937 engine(std::random_device{}());
+    std::bernoulli_distribution distribution;
+
+    // Random words, and their bits as booleans
+    container_type cont(words);
+    container_type other(words);
+    std::vector<bool> boolcont(words * digits);
+    std::vector<bool> boolother(words * digits);
+    iterator_type first(cont.begin());
+    iterator_type last(cont.end());
+    iterator_type d_first(other.begin());
+    for (std::size_t i = 0; i < boolcont.size(); ++i) {
+        boolcont[i] = distribution(engine);
+        first[i] = boolcont[i] ? bit::bit1 : bit::bit0;
+    }
+    auto bool_first = boolcont.begin();
+    auto bool_d_first = boolother.begin();
+    const std::ptrdiff_t size = boolcont.size();
+    auto matches = [&]{
+        return std::equal(first, last, bool_first, comparator)
+            && std::equal(d_first, d_first + size, bool_d_first, comparator);
+    };
+
+    // Counts, searches and comparisons
+    REQUIRE(bit::count(first + 3, last - 5, bit::bit1)
+            == std::count(bool_first + 3, bool_first + size - 5, true));
+    REQUIRE(bit::distance(first, bit::find(first + 7, last, bit::bit0))
+            == std::find(bool_first + 7, bool_first + size, false)
+               - bool_first);
+    REQUIRE(bit::distance(first, bit::max_element(first + 1, last))
+            == std::max_element(bool_first + 1, bool_first + size)
+               - bool_first);
+    REQUIRE(bit::equal(first + 2, last, first + 2));
+
+    // Copies, fills and transforms between offsets
+    bit::copy(first + 5, last - 70, d_first + 61);
+    std::copy(bool_first + 5, bool_first + size - 70, bool_d_first + 61);
+    REQUIRE(matches());
+    bit::fill(d_first + 9, d_first + size - 100, bit::bit1);
+    std::fill(bool_d_first + 9, bool_d_first + size - 100, true);
+    REQUIRE(matches());
+    bit::transform(first + 1, last, d_first + 1, std::bit_not<>());
+    std::transform(bool_first + 1, bool_first + size, bool_d_first + 1,
+        std::logical_not<>());
+    REQUIRE(matches());
+
+    // In place reorderings
+    bit::reverse(first + 11, last - 13);
+    std::reverse(bool_first + 11, bool_first + size - 13);
+    REQUIRE(matches());
+    for (std::ptrdiff_t n : {1, 65, 300}) {
+        bit::shift_left(first + 3, last, n);
+        std::copy(bool_first + 3 + n, bool_first + size, bool_first + 3);
+        std::fill(bool_first + size - n, bool_first + size, false);
+        REQUIRE(matches());
+        bit::shift_right(first, last - 2, n);
+        std::copy_backward(bool_first, bool_first + size - 2 - n,
+            bool_first + size - 2);
+        std::fill(bool_first, bool_first + n, false);
+        REQUIRE(matches());
+    }
+}
+// -------------------------------------------------------------------------- //
+
+
+
+// ========================================================================== //
+#endif // _WIDE_WORD_TESTS_HPP_INCLUDED
+// ========================================================================== //